@@ -0,0 +1,384 @@
+#ifndef MARKET_DATA_SYSTEM_ASYNC_LOGGER_H
+#define MARKET_DATA_SYSTEM_ASYNC_LOGGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file async_logger.h
+ * @brief Binary-record logger: hot threads enqueue, a background thread formats.
+ *
+ * logInfo("[Rate] {} / s", rate) copies a pointer to the format string, a
+ * decoder instantiated for the argument types and the raw argument bytes
+ * into the calling thread's own SPSC byte ring - no formatting, no lock,
+ * no syscall, no allocation after the thread's first log call. The logger
+ * thread drains every ring, formats with std::vformat and writes stdout /
+ * stderr in one fwrite per pass. A full ring drops the record (counted and
+ * reported) rather than blocking the caller.
+ *
+ * Arguments are stored by value: arithmetic types, enums and pointers as
+ * their bytes, strings (std::string, string_view, const char *) as their
+ * characters. Format strings must outlive the program (string literals).
+ * Per-thread order is preserved; lines of different threads interleave at
+ * drain granularity.
+ */
+
+enum class LogLevel : uint8_t
+{
+    Info,  // stdout
+    Warn,  // stderr
+    Error, // stderr
+};
+
+namespace logdetail
+{
+    template <typename T>
+    inline constexpr bool IS_STRING = std::is_convertible_v<const T &, std::string_view>;
+
+    // What an argument is stored / decoded as
+    template <typename T>
+    using Stored = std::conditional_t<IS_STRING<std::decay_t<T>>, std::string_view, std::decay_t<T>>;
+
+    template <typename T>
+    std::size_t encodedSize(const T &value)
+    {
+        if constexpr (IS_STRING<T>)
+            return sizeof(uint32_t) + std::string_view(value).size();
+        else
+            return sizeof(T);
+    }
+
+    template <typename T>
+    std::byte *encode(std::byte *out, const T &value)
+    {
+        if constexpr (IS_STRING<T>)
+        {
+            std::string_view s(value);
+            uint32_t length = static_cast<uint32_t>(s.size());
+            std::memcpy(out, &length, sizeof(length));
+            std::memcpy(out + sizeof(length), s.data(), length);
+            return out + sizeof(length) + length;
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "log arguments must be trivially copyable or strings");
+            std::memcpy(out, &value, sizeof(T));
+            return out + sizeof(T);
+        }
+    }
+
+    template <typename S>
+    const std::byte *decode(const std::byte *in, S &value)
+    {
+        if constexpr (std::is_same_v<S, std::string_view>)
+        {
+            uint32_t length;
+            std::memcpy(&length, in, sizeof(length));
+            value = std::string_view(reinterpret_cast<const char *>(in + sizeof(length)), length);
+            return in + sizeof(length) + length;
+        }
+        else
+        {
+            std::memcpy(&value, in, sizeof(S));
+            return in + sizeof(S);
+        }
+    }
+
+    using DecodeFn = void (*)(std::string_view format, const std::byte *args, std::string &out);
+
+    // Rebuilds the arguments from their bytes and formats them onto out (logger thread)
+    template <typename... Values>
+    void decodeAndFormat(std::string_view format, const std::byte *args, std::string &out)
+    {
+        std::tuple<Values...> values;
+        std::apply([&](auto &...value)
+                   { ((args = decode(args, value)), ...); }, values);
+        std::apply([&](auto &...value)
+                   { out += std::vformat(format, std::make_format_args(value...)); }, values);
+    }
+
+    struct RecordHeader
+    {
+        DecodeFn decode; // nullptr = padding up to the end of the ring
+        const char *format;
+        uint32_t formatLength;
+        uint32_t size; // Whole record incl. header, RECORD_ALIGN multiple
+        LogLevel level;
+    };
+
+    // Records start on header-size boundaries, so the gap left at the end of
+    // the ring always has room for a padding header
+    inline constexpr std::size_t RECORD_ALIGN = 32;
+    static_assert(sizeof(RecordHeader) <= RECORD_ALIGN);
+} // namespace logdetail
+
+/**
+ * @brief One thread's log records, that thread writes and the logger thread reads.
+ *
+ * Positions are free-running byte counters; a record never wraps, the
+ * space left at the end is skipped with a padding header instead.
+ */
+class LogRing
+{
+public:
+    static constexpr std::size_t CAPACITY = 64 * 1024;
+
+    // Writer: room for size bytes, or nullptr (full). commit() publishes it.
+    std::byte *reserve(std::size_t size)
+    {
+        std::size_t offset = head_ % CAPACITY;
+        std::size_t padding = (CAPACITY - offset < size) ? CAPACITY - offset : 0;
+        if (head_ + padding + size - tailCache_ > CAPACITY)
+        {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head_ + padding + size - tailCache_ > CAPACITY)
+                return nullptr;
+        }
+        if (padding)
+        {
+            logdetail::RecordHeader pad{nullptr, nullptr, 0, static_cast<uint32_t>(padding), LogLevel::Info};
+            std::memcpy(buffer_.get() + offset, &pad, sizeof(pad));
+            head_ += padding;
+            offset = 0;
+        }
+        return buffer_.get() + offset;
+    }
+
+    void commit(std::size_t size)
+    {
+        head_ += size;
+        published_.store(head_, std::memory_order_release);
+    }
+
+    // Reader: calls fn(header, args) for every committed record, returns how many
+    template <typename Fn>
+    std::size_t drain(Fn &&fn)
+    {
+        uint64_t head = published_.load(std::memory_order_acquire);
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t records = 0;
+        while (tail != head)
+        {
+            const std::byte *at = buffer_.get() + tail % CAPACITY;
+            logdetail::RecordHeader header;
+            std::memcpy(&header, at, sizeof(header));
+            if (header.decode)
+            {
+                fn(header, at + sizeof(header));
+                ++records;
+            }
+            tail += header.size;
+        }
+        tail_.store(tail, std::memory_order_release);
+        return records;
+    }
+
+    bool empty() const { return published_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed); }
+
+    // Writer counts, reader reports
+    void countDrop() { dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    std::atomic<bool> closed{false}; // Owning thread exited
+
+private:
+    std::unique_ptr<std::byte[]> buffer_ = std::make_unique<std::byte[]>(CAPACITY);
+    // --- Writer ---
+    alignas(64) uint64_t head_ = 0;
+    uint64_t tailCache_ = 0;
+    std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> dropped_{0};
+    // --- Reader ---
+    alignas(64) std::atomic<uint64_t> tail_{0};
+};
+
+class AsyncLogger
+{
+public:
+    static AsyncLogger &instance()
+    {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    // Records below this level are discarded at the call site (one relaxed load)
+    void setMinLevel(LogLevel level) { minLevel_.store(level, std::memory_order_relaxed); }
+    bool enabled(LogLevel level) const { return level >= minLevel_.load(std::memory_order_relaxed); }
+
+    template <typename... Args>
+    void log(LogLevel level, std::string_view format, const Args &...args)
+    {
+        if (!enabled(level))
+            return;
+
+        using namespace logdetail;
+        const std::size_t size = (sizeof(RecordHeader) + (std::size_t{0} + ... + encodedSize(args)) + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+        LogRing &ring = threadRing();
+        std::byte *out = size <= LogRing::CAPACITY / 2 ? ring.reserve(size) : nullptr;
+        if (!out)
+        {
+            ring.countDrop();
+            return;
+        }
+
+        RecordHeader header{&decodeAndFormat<Stored<Args>...>, format.data(), static_cast<uint32_t>(format.size()),
+                            static_cast<uint32_t>(size), level};
+        std::memcpy(out, &header, sizeof(header));
+        [[maybe_unused]] std::byte *at = out + sizeof(header);
+        ((at = encode(at, args)), ...);
+        ring.commit(size);
+    }
+
+    // Blocks until everything logged so far has been written
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(flushMutex_);
+        drainAll();
+    }
+
+    ~AsyncLogger()
+    {
+        running_.store(false, std::memory_order_relaxed);
+        if (worker_.joinable())
+            worker_.join();
+        flush();
+    }
+
+    AsyncLogger(const AsyncLogger &) = delete;
+    AsyncLogger &operator=(const AsyncLogger &) = delete;
+
+private:
+    static constexpr auto IDLE_SLEEP = std::chrono::milliseconds(1);
+
+    std::atomic<LogLevel> minLevel_{LogLevel::Info};
+    std::atomic<bool> running_{true};
+    std::mutex ringsMutex_; // Registration vs the drain loop walking rings_
+    std::mutex flushMutex_; // One drainer at a time
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    std::vector<uint64_t> reportedDrops_;
+    std::string out_;
+    std::string err_;
+    std::jthread worker_;
+
+    AsyncLogger()
+    {
+        worker_ = std::jthread([this]
+                               {
+            while (running_.load(std::memory_order_relaxed))
+            {
+                std::size_t written;
+                {
+                    std::unique_lock<std::mutex> lock(flushMutex_);
+                    written = drainAll();
+                }
+                if (written == 0)
+                    std::this_thread::sleep_for(IDLE_SLEEP);
+            } });
+    }
+
+    // Keeps the ring alive past its thread and marks it for collection
+    struct RingHandle
+    {
+        std::shared_ptr<LogRing> ring;
+        ~RingHandle()
+        {
+            if (ring)
+                ring->closed.store(true, std::memory_order_release);
+        }
+    };
+
+    LogRing &threadRing()
+    {
+        thread_local RingHandle handle;
+        if (!handle.ring)
+        {
+            handle.ring = std::make_shared<LogRing>();
+            std::lock_guard<std::mutex> lock(ringsMutex_);
+            rings_.push_back(handle.ring);
+            reportedDrops_.push_back(0);
+        }
+        return *handle.ring;
+    }
+
+    // Format and write every pending record (caller holds flushMutex_)
+    std::size_t drainAll()
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        std::size_t records = 0;
+        for (std::size_t i = 0; i < rings_.size(); ++i)
+        {
+            LogRing &ring = *rings_[i];
+            records += ring.drain([this](const logdetail::RecordHeader &header, const std::byte *args)
+                                  {
+                std::string &sink = header.level == LogLevel::Info ? out_ : err_;
+                header.decode(std::string_view(header.format, header.formatLength), args, sink);
+                sink += '\n'; });
+
+            uint64_t dropped = ring.dropped();
+            if (dropped != reportedDrops_[i])
+            {
+                err_ += std::format("[Log] {} records dropped (ring full)\n", dropped - reportedDrops_[i]);
+                reportedDrops_[i] = dropped;
+            }
+        }
+
+        // Rings of exited threads go once drained
+        for (std::size_t i = rings_.size(); i-- > 0;)
+        {
+            if (rings_[i]->closed.load(std::memory_order_acquire) && rings_[i]->empty())
+            {
+                rings_.erase(rings_.begin() + static_cast<std::ptrdiff_t>(i));
+                reportedDrops_.erase(reportedDrops_.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+
+        write(stdout, out_);
+        write(stderr, err_);
+        return records;
+    }
+
+    static void write(std::FILE *stream, std::string &text)
+    {
+        if (text.empty())
+            return;
+        std::fwrite(text.data(), 1, text.size(), stream);
+        std::fflush(stream);
+        text.clear();
+    }
+};
+
+// Enqueue a log line from any thread (see AsyncLogger)
+template <typename... Args>
+void logInfo(std::format_string<const Args &...> format, const Args &...args)
+{
+    AsyncLogger::instance().log(LogLevel::Info, format.get(), args...);
+}
+
+template <typename... Args>
+void logWarn(std::format_string<const Args &...> format, const Args &...args)
+{
+    AsyncLogger::instance().log(LogLevel::Warn, format.get(), args...);
+}
+
+template <typename... Args>
+void logError(std::format_string<const Args &...> format, const Args &...args)
+{
+    AsyncLogger::instance().log(LogLevel::Error, format.get(), args...);
+}
+
+#endif // MARKET_DATA_SYSTEM_ASYNC_LOGGER_H
@@ -0,0 +1,186 @@
+#ifndef MARKET_DATA_SYSTEM_BYTE_RING_BUFFER_H
+#define MARKET_DATA_SYSTEM_BYTE_RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include <core/nonblocking_ring_buffer.h> // CACHE_LINE_SIZE
+
+/**
+ * @brief SPSC ring of variable-length records, stored contiguously.
+ *
+ * Each record is an 8-byte header (payload length, kind) followed by the
+ * payload, rounded up to 8 bytes, so an 80-byte message takes 88 bytes of
+ * ring instead of a max-size slot. A record never wraps: when it does not
+ * fit before the end of the buffer, the writer fills the rest with a
+ * padding record and starts again at offset 0; the reader skips padding.
+ *
+ * Writer:  reserve(n) -> n writable bytes in place (empty = not enough room),
+ *          fill them (e.g. encode straight into the span), commit(used) with
+ *          used <= n. A reservation that is not committed is simply dropped.
+ * Reader:  read() -> the oldest unread record's payload in place (empty =
+ *          none), hand it on (e.g. to send()), then release(). Several
+ *          read()s before one release() walk consecutive records (a send
+ *          batch); release() frees all of them at once. peek() returns the
+ *          record the next read() will, without consuming it.
+ *
+ * Positions are free-running byte counters. Each side keeps a cached copy
+ * of the other side's position and only reloads the shared atomic when the
+ * cache says full / empty, so in steady state neither touches the other's
+ * cache line.
+ *
+ * @tparam Capacity  Bytes, a power of two. The largest record is Capacity / 2.
+ */
+template <std::size_t Capacity>
+    requires(std::has_single_bit(Capacity) && Capacity >= 64)
+class ByteRingBuffer
+{
+public:
+    static constexpr std::size_t HEADER_SIZE = 8;
+    static constexpr std::size_t MAX_RECORD = Capacity / 2 - HEADER_SIZE;
+
+    ByteRingBuffer() = default;
+
+    ByteRingBuffer(const ByteRingBuffer &) = delete;
+    ByteRingBuffer &operator=(const ByteRingBuffer &) = delete;
+
+    // --- Writer ---
+    [[nodiscard]] std::span<uint8_t> reserve(std::size_t size) noexcept
+    {
+        if (size > MAX_RECORD)
+            return {};
+
+        const std::size_t needed = recordSize(size);
+        const std::size_t offset = write_ & MASK;
+        // Not enough room before the end: pad it out and start at 0
+        const std::size_t padding = (Capacity - offset < needed) ? Capacity - offset : 0;
+        if (write_ + padding + needed - readCache_ > Capacity)
+        {
+            readCache_ = readPos_.load(std::memory_order_acquire);
+            if (write_ + padding + needed - readCache_ > Capacity)
+                return {};
+        }
+
+        if (padding)
+        {
+            writeHeader(offset, static_cast<uint32_t>(padding - HEADER_SIZE), PADDING);
+            write_ += padding;
+        }
+        return {buffer_.data() + (write_ & MASK) + HEADER_SIZE, size};
+    }
+
+    // Publish the last reservation with its first `used` bytes
+    void commit(std::size_t used) noexcept
+    {
+        writeHeader(write_ & MASK, static_cast<uint32_t>(used), RECORD);
+        write_ += recordSize(used);
+        writePos_.store(write_, std::memory_order_release);
+    }
+
+    // --- Reader ---
+    [[nodiscard]] std::span<const uint8_t> read() noexcept
+    {
+        for (;;)
+        {
+            if (read_ == writeCache_)
+            {
+                writeCache_ = writePos_.load(std::memory_order_acquire);
+                if (read_ == writeCache_)
+                    return {};
+            }
+
+            const std::size_t offset = read_ & MASK;
+            Header header;
+            std::memcpy(&header, buffer_.data() + offset, sizeof(header));
+            if (header.kind == PADDING)
+            {
+                read_ += HEADER_SIZE + header.length;
+                continue;
+            }
+            read_ += recordSize(header.length);
+            return {buffer_.data() + offset + HEADER_SIZE, header.length};
+        }
+    }
+
+    // The record the next read() returns, left unread (empty = none)
+    [[nodiscard]] std::span<const uint8_t> peek() noexcept
+    {
+        for (;;)
+        {
+            if (read_ == writeCache_)
+            {
+                writeCache_ = writePos_.load(std::memory_order_acquire);
+                if (read_ == writeCache_)
+                    return {};
+            }
+
+            const std::size_t offset = read_ & MASK;
+            Header header;
+            std::memcpy(&header, buffer_.data() + offset, sizeof(header));
+            if (header.kind == PADDING)
+            {
+                // Nothing to hand out, skipping it is the same as reading it
+                read_ += HEADER_SIZE + header.length;
+                continue;
+            }
+            return {buffer_.data() + offset + HEADER_SIZE, header.length};
+        }
+    }
+
+    // Done with every record read() so far, their bytes go back to the writer
+    void release() noexcept
+    {
+        readPos_.store(read_, std::memory_order_release);
+    }
+
+    // Bytes in use incl. headers and padding (approximate while both sides run)
+    std::size_t size() const noexcept
+    {
+        return writePos_.load(std::memory_order_acquire) - readPos_.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+    // Ring bytes one record of `size` payload bytes occupies
+    static constexpr std::size_t recordSize(std::size_t size) noexcept
+    {
+        return (HEADER_SIZE + size + 7) & ~std::size_t{7};
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    static constexpr uint32_t RECORD = 0;
+    static constexpr uint32_t PADDING = 1;
+
+    struct Header
+    {
+        uint32_t length; // Payload bytes (padding: bytes skipped after the header)
+        uint32_t kind;
+    };
+    static_assert(sizeof(Header) == HEADER_SIZE);
+
+    void writeHeader(std::size_t offset, uint32_t length, uint32_t kind) noexcept
+    {
+        Header header{length, kind};
+        std::memcpy(buffer_.data() + offset, &header, sizeof(header));
+    }
+
+    // --- Writer side ---
+    alignas(CACHE_LINE_SIZE) uint64_t write_ = 0;
+    uint64_t readCache_ = 0;
+    // --- Shared positions, one line each ---
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> writePos_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> readPos_{0};
+    // --- Reader side ---
+    alignas(CACHE_LINE_SIZE) uint64_t read_ = 0; // Past the last record read(), published by release()
+    uint64_t writeCache_ = 0;
+
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t, Capacity> buffer_;
+};
+
+#endif // MARKET_DATA_SYSTEM_BYTE_RING_BUFFER_H
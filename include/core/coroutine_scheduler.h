@@ -0,0 +1,237 @@
+#ifndef MARKET_DATA_SYSTEM_COROUTINE_SCHEDULER_H
+#define MARKET_DATA_SYSTEM_COROUTINE_SCHEDULER_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h> // For pthread_setaffinity_np()
+#include <sched.h>
+#endif
+
+#include <core/timer_wheel.h>
+#include <core/tsc_clock.h>
+
+class CoroutineScheduler;
+
+/**
+ * @brief Coroutine type for scheduled tasks.
+ *
+ * Starts suspended; CoroutineScheduler::spawn() takes ownership of the frame
+ * and resumes it on the scheduler thread. Frames are destroyed with the scheduler.
+ */
+class ScheduledTask
+{
+public:
+    struct promise_type
+    {
+        CoroutineScheduler *scheduler = nullptr;
+
+        ScheduledTask get_return_object()
+        {
+            return ScheduledTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept;
+    };
+
+    ScheduledTask(ScheduledTask &&other) noexcept : handle_{std::exchange(other.handle_, {})} {}
+    ScheduledTask(const ScheduledTask &) = delete;
+    ScheduledTask &operator=(const ScheduledTask &) = delete;
+    ScheduledTask &operator=(ScheduledTask &&) = delete;
+
+    ~ScheduledTask()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+private:
+    friend class CoroutineScheduler;
+    explicit ScheduledTask(std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// Where "now" comes from
+enum class SchedulerClock
+{
+    RealTime, // TSC, timers fire when wall-clock reaches them
+    Virtual   // Time jumps straight to the next timer (offline / benchmarks)
+};
+
+/**
+ * @brief Single-threaded coroutine scheduler driven by a TimerWheel.
+ *
+ * Tasks suspend with `co_await scheduler.sleepUntil(ns)`. The awaiter embeds
+ * the TimerNode, so a suspension costs no allocation: it is one O(1) wheel
+ * insert, and the run loop resumes due coroutines straight from the wheel.
+ *
+ * Times are nanoseconds since run() started (RealTime) or since 0 (Virtual),
+ * quantised to resolutionNs for wake-ups.
+ */
+class CoroutineScheduler
+{
+public:
+    explicit CoroutineScheduler(SchedulerClock clock = SchedulerClock::RealTime, uint64_t resolutionNs = 1000)
+        : clock_{clock},
+          resolutionNs_{resolutionNs}
+    {
+        if (resolutionNs == 0)
+        {
+            throw std::invalid_argument("CoroutineScheduler: resolution must be > 0");
+        }
+    }
+
+    ~CoroutineScheduler()
+    {
+        for (auto handle : tasks_)
+            handle.destroy();
+    }
+
+    CoroutineScheduler(const CoroutineScheduler &) = delete;
+    CoroutineScheduler &operator=(const CoroutineScheduler &) = delete;
+
+    // Awaitable returned by sleepUntil()
+    struct SleepAwaiter
+    {
+        CoroutineScheduler &scheduler;
+        TimerNode node;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            node.handle = handle;
+            scheduler.wheel_.schedule(&node);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Suspends the calling task until deadlineNs (no-op wait if already past).
+     */
+    SleepAwaiter sleepUntil(uint64_t deadlineNs)
+    {
+        SleepAwaiter awaiter{*this, {}};
+        awaiter.node.deadline = deadlineNs / resolutionNs_;
+        return awaiter;
+    }
+
+    /**
+     * @brief Takes ownership of task and runs it up to its first co_await.
+     */
+    void spawn(ScheduledTask task)
+    {
+        auto handle = std::exchange(task.handle_, {});
+        handle.promise().scheduler = this;
+        tasks_.push_back(handle);
+
+        nowNs_ = wheel_.current() * resolutionNs_;
+        handle.resume();
+        rethrowPending();
+    }
+
+    /**
+     * @brief Runs tasks on the calling thread until running is false, the
+     * wheel empties or time passes untilNs.
+     *
+     * @param cpu  Pin the calling thread to this core first (-1 = leave as is)
+     * @return Number of coroutine resumptions
+     */
+    uint64_t run(const std::atomic<bool> &running, uint64_t untilNs = TimerWheel::NO_TIMER, int cpu = -1)
+    {
+        if (cpu >= 0)
+            pinCurrentThread(cpu);
+
+        const uint64_t untilTick = untilNs == TimerWheel::NO_TIMER ? TimerWheel::NO_TIMER - 1 : untilNs / resolutionNs_;
+        auto resume = [this](TimerNode *node)
+        {
+            nowNs_ = node->deadline * resolutionNs_;
+            node->handle.resume();
+        };
+
+        uint64_t resumed = 0;
+        if (clock_ == SchedulerClock::Virtual)
+        {
+            while (running.load(std::memory_order_relaxed))
+            {
+                std::size_t fired = wheel_.fireNext(resume, untilTick);
+                rethrowPending();
+                if (fired == 0)
+                    break; // Empty, or nothing left before untilNs
+                resumed += fired;
+            }
+            return resumed;
+        }
+
+        const uint64_t startTsc = TscClock::now();
+        while (running.load(std::memory_order_relaxed) && !wheel_.empty())
+        {
+            const uint64_t elapsedNs = static_cast<uint64_t>(TscClock::toNs(TscClock::now() - startTsc));
+            const uint64_t nowTick = elapsedNs / resolutionNs_;
+            if (nowTick > untilTick)
+                break;
+
+            std::size_t fired = wheel_.advance(nowTick, resume);
+            rethrowPending();
+            resumed += fired;
+            if (fired == 0)
+                cpuRelax(); // Pinned thread: spin rather than sleep
+        }
+        return resumed;
+    }
+
+    // Time of the timer currently being serviced, in ns
+    uint64_t nowNs() const { return nowNs_; }
+
+    uint64_t resolutionNs() const { return resolutionNs_; }
+    std::size_t pendingTimers() const { return wheel_.size(); }
+
+private:
+    friend struct ScheduledTask::promise_type;
+
+    SchedulerClock clock_;
+    uint64_t resolutionNs_;
+    uint64_t nowNs_ = 0;
+    TimerWheel wheel_;
+    std::vector<std::coroutine_handle<ScheduledTask::promise_type>> tasks_;
+    std::exception_ptr pending_;
+
+    void rethrowPending()
+    {
+        if (pending_)
+            std::rethrow_exception(std::exchange(pending_, nullptr));
+    }
+
+    static void pinCurrentThread(int cpu)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            throw std::runtime_error("CoroutineScheduler: failed to pin to CPU " + std::to_string(cpu));
+        }
+#else
+        (void)cpu; // Affinity not supported on this platform
+#endif
+    }
+};
+
+inline void ScheduledTask::promise_type::unhandled_exception() noexcept
+{
+    // Surfaced from run() on the scheduler thread
+    if (scheduler)
+        scheduler->pending_ = std::current_exception();
+}
+
+#endif // MARKET_DATA_SYSTEM_COROUTINE_SCHEDULER_H
@@ -0,0 +1,156 @@
+#ifndef MARKET_DATA_SYSTEM_LATENCY_HISTOGRAM_H
+#define MARKET_DATA_SYSTEM_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Log-bucketed histogram of non-negative integers (TSC ticks), one writer.
+ *
+ * Values below 16 get a bucket each; above that every power of two is
+ * split into 16 linear sub-buckets, so a bucket is at most 1/16 (6.25%)
+ * wide relative to its value over the whole uint64_t range. The bucket
+ * array is fixed, record() never allocates and costs a clz and one
+ * relaxed counter update.
+ *
+ * Single writer (the thread that owns it), any number of readers: counts
+ * are plain relaxed load / store, readers see monotonically growing
+ * counters and take interval deltas from snapshots.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+    static constexpr std::size_t SUB_BUCKETS = std::size_t{1} << SUB_BUCKET_BITS;
+    static constexpr std::size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    static constexpr std::size_t bucketOf(uint64_t value)
+    {
+        if (value < SUB_BUCKETS)
+            return static_cast<std::size_t>(value);
+        unsigned msb = 63u - static_cast<unsigned>(std::countl_zero(value));
+        unsigned shift = msb - SUB_BUCKET_BITS;
+        return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1));
+    }
+
+    // Largest value that lands in bucket (values are reported at their bucket's upper edge)
+    static constexpr uint64_t bucketUpperBound(std::size_t bucket)
+    {
+        if (bucket < SUB_BUCKETS)
+            return bucket;
+        unsigned shift = static_cast<unsigned>(bucket / SUB_BUCKETS) - 1;
+        uint64_t sub = bucket % SUB_BUCKETS;
+        uint64_t lower = (SUB_BUCKETS + sub) << shift;
+        return lower + ((uint64_t{1} << shift) - 1);
+    }
+
+    // Owning thread only
+    void record(uint64_t value) noexcept
+    {
+        auto &slot = counts_[bucketOf(value)];
+        slot.store(slot.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (value > max_.load(std::memory_order_relaxed))
+            max_.store(value, std::memory_order_relaxed);
+    }
+
+    // Cumulative counts (reader side)
+    void snapshot(std::array<uint64_t, BUCKETS> &out) const
+    {
+        for (std::size_t i = 0; i < BUCKETS; ++i)
+            out[i] = counts_[i].load(std::memory_order_relaxed);
+    }
+
+    // Largest value since the previous takeMax() (reader side, one reader)
+    uint64_t takeMax() { return max_.exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS> counts_{};
+    alignas(64) std::atomic<uint64_t> max_{0};
+};
+
+// Percentiles of one interval of a histogram, in the histogram's units
+struct LatencySummary
+{
+    uint64_t count = 0;
+    uint64_t p50 = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+    uint64_t max = 0;
+};
+
+/**
+ * @brief Accumulates interval deltas of several histograms and reads percentiles.
+ *
+ * Reader-side helper: add() the delta between a histogram's current and
+ * previous snapshot (and its takeMax()) for every thread, then summary().
+ * Merging per-thread histograms is just summing their buckets.
+ */
+class LatencyInterval
+{
+public:
+    void clear()
+    {
+        counts_.fill(0);
+        total_ = 0;
+        max_ = 0;
+    }
+
+    // Adds current - previous, then moves current into previous
+    void add(LatencyHistogram &histogram, std::array<uint64_t, LatencyHistogram::BUCKETS> &previous)
+    {
+        histogram.snapshot(current_);
+        for (std::size_t i = 0; i < LatencyHistogram::BUCKETS; ++i)
+        {
+            uint64_t delta = current_[i] - previous[i];
+            counts_[i] += delta;
+            total_ += delta;
+        }
+        previous = current_;
+        max_ = std::max(max_, histogram.takeMax());
+    }
+
+    LatencySummary summary() const
+    {
+        LatencySummary result;
+        result.count = total_;
+        result.max = max_;
+        if (total_ == 0)
+            return result;
+
+        // Rank of each percentile (1-based), filled in one pass over the buckets
+        const uint64_t ranks[3] = {rank(0.50), rank(0.99), rank(0.999)};
+        uint64_t *outputs[3] = {&result.p50, &result.p99, &result.p999};
+        uint64_t seen = 0;
+        std::size_t next = 0;
+        for (std::size_t i = 0; i < LatencyHistogram::BUCKETS && next < 3; ++i)
+        {
+            seen += counts_[i];
+            while (next < 3 && seen >= ranks[next])
+            {
+                // A bucket edge can overshoot the true max, clamp to it
+                uint64_t edge = LatencyHistogram::bucketUpperBound(i);
+                *outputs[next] = max_ ? std::min(edge, max_) : edge;
+                ++next;
+            }
+        }
+        return result;
+    }
+
+private:
+    std::array<uint64_t, LatencyHistogram::BUCKETS> counts_{};
+    std::array<uint64_t, LatencyHistogram::BUCKETS> current_{};
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+
+    uint64_t rank(double quantile) const
+    {
+        uint64_t r = static_cast<uint64_t>(quantile * static_cast<double>(total_) + 0.5);
+        return std::clamp<uint64_t>(r, 1, total_);
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_LATENCY_HISTOGRAM_H
@@ -0,0 +1,241 @@
+#ifndef MARKET_DATA_SYSTEM_METRICS_REGISTRY_H
+#define MARKET_DATA_SYSTEM_METRICS_REGISTRY_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <core/latency_histogram.h>
+
+/**
+ * @brief One thread's metrics: counters, gauges and histograms it alone writes.
+ *
+ * Every slot has a single writer (the owning thread), so updates are a
+ * relaxed load + store - no locked RMW - and the block is cache-line
+ * aligned so no other thread's writes share its lines. Readers (the
+ * collector) only load. Slots are addressed by the index the registry
+ * handed out for a metric name.
+ */
+class alignas(64) ThreadMetrics
+{
+public:
+    static constexpr std::size_t MAX_COUNTERS = 32;
+    static constexpr std::size_t MAX_GAUGES = 8;
+    static constexpr std::size_t MAX_HISTOGRAMS = 8;
+
+    explicit ThreadMetrics(std::string name) : name_{std::move(name)} {}
+
+    ThreadMetrics(const ThreadMetrics &) = delete;
+    ThreadMetrics &operator=(const ThreadMetrics &) = delete;
+
+    // --- Owning thread ---
+    void add(std::size_t counter, uint64_t n = 1) noexcept
+    {
+        auto &slot = counters_[counter];
+        slot.store(slot.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void set(std::size_t gauge, int64_t value) noexcept { gauges_[gauge].store(value, std::memory_order_relaxed); }
+
+    LatencyHistogram &histogram(std::size_t id) noexcept { return histograms_[id]; }
+
+    // --- Any thread ---
+    uint64_t counter(std::size_t id) const { return counters_[id].load(std::memory_order_relaxed); }
+    int64_t gauge(std::size_t id) const { return gauges_[id].load(std::memory_order_relaxed); }
+    const std::string &name() const { return name_; }
+
+private:
+    std::string name_;
+    alignas(64) std::array<std::atomic<uint64_t>, MAX_COUNTERS> counters_{};
+    alignas(64) std::array<std::atomic<int64_t>, MAX_GAUGES> gauges_{};
+    std::array<LatencyHistogram, MAX_HISTOGRAMS> histograms_;
+};
+
+/**
+ * @brief Metric names -> slot indices, plus the ThreadMetrics of every thread.
+ *
+ * Setup only (constructors / before start()): names and threads are
+ * registered up front so the hot path holds a ThreadMetrics & and an index
+ * and never looks anything up. Registering the same name twice returns the
+ * same index.
+ */
+class MetricsRegistry
+{
+public:
+    std::size_t counter(std::string_view name) { return idOf(counterNames_, name, ThreadMetrics::MAX_COUNTERS); }
+    std::size_t gauge(std::string_view name) { return idOf(gaugeNames_, name, ThreadMetrics::MAX_GAUGES); }
+    std::size_t histogram(std::string_view name) { return idOf(histogramNames_, name, ThreadMetrics::MAX_HISTOGRAMS); }
+
+    ThreadMetrics &registerThread(std::string name)
+    {
+        return *threads_.emplace_back(std::make_unique<ThreadMetrics>(std::move(name)));
+    }
+
+    // Sum of a counter over every thread (reader side)
+    uint64_t total(std::size_t counter) const
+    {
+        uint64_t sum = 0;
+        for (const auto &thread : threads_)
+            sum += thread->counter(counter);
+        return sum;
+    }
+
+    const std::vector<std::string> &counterNames() const { return counterNames_; }
+    const std::vector<std::string> &gaugeNames() const { return gaugeNames_; }
+    const std::vector<std::string> &histogramNames() const { return histogramNames_; }
+    const std::vector<std::unique_ptr<ThreadMetrics>> &threads() const { return threads_; }
+
+private:
+    std::vector<std::string> counterNames_;
+    std::vector<std::string> gaugeNames_;
+    std::vector<std::string> histogramNames_;
+    std::vector<std::unique_ptr<ThreadMetrics>> threads_;
+
+    static std::size_t idOf(std::vector<std::string> &names, std::string_view name, std::size_t capacity)
+    {
+        auto it = std::find(names.begin(), names.end(), name);
+        if (it != names.end())
+            return static_cast<std::size_t>(it - names.begin());
+        if (names.size() == capacity)
+            throw std::length_error("MetricsRegistry: too many metrics of this kind for " + std::string(name));
+        names.emplace_back(name);
+        return names.size() - 1;
+    }
+};
+
+/**
+ * @brief Reader side: snapshots one or more registries and reports deltas.
+ *
+ * Each collect() sums every counter by name over all threads of all
+ * registries and keeps the previous sums, so a rate window is the exact
+ * difference of two monotonically growing totals - nothing is reset and
+ * no increment is lost between windows. Histograms are merged by name
+ * over threads into the interval since the previous collect().
+ * One collector per monitor thread.
+ */
+class MetricsCollector
+{
+public:
+    explicit MetricsCollector(std::vector<const MetricsRegistry *> registries)
+        : registries_{std::move(registries)}
+    {
+    }
+
+    void collect()
+    {
+        for (auto &[name, state] : counters_)
+            state.previous = state.current;
+        for (auto &[name, state] : counters_)
+            state.current = 0;
+        for (auto &[name, value] : gauges_)
+            value = 0;
+
+        for (const MetricsRegistry *registry : registries_)
+        {
+            const auto &counterNames = registry->counterNames();
+            for (std::size_t id = 0; id < counterNames.size(); ++id)
+                counters_[counterNames[id]].current += registry->total(id);
+
+            const auto &gaugeNames = registry->gaugeNames();
+            for (std::size_t id = 0; id < gaugeNames.size(); ++id)
+            {
+                int64_t &value = gauges_[gaugeNames[id]];
+                for (const auto &thread : registry->threads())
+                    value = std::max(value, thread->gauge(id));
+            }
+        }
+
+        for (auto &[name, summary] : histograms_)
+            summary = {};
+        collectHistograms();
+    }
+
+    // Increase of a counter between the last two collect() calls, summed over threads
+    uint64_t delta(std::string_view counter) const
+    {
+        auto it = counters_.find(counter);
+        return it == counters_.end() ? 0 : it->second.current - it->second.previous;
+    }
+
+    // Value at the last collect()
+    uint64_t total(std::string_view counter) const
+    {
+        auto it = counters_.find(counter);
+        return it == counters_.end() ? 0 : it->second.current;
+    }
+
+    // Largest value of a gauge over threads at the last collect() (gauges are non-negative)
+    int64_t gauge(std::string_view name) const
+    {
+        auto it = gauges_.find(name);
+        return it == gauges_.end() ? 0 : it->second;
+    }
+
+    // Histogram merged over threads, interval between the last two collect() calls
+    LatencySummary histogram(std::string_view name) const
+    {
+        auto it = histograms_.find(name);
+        return it == histograms_.end() ? LatencySummary{} : it->second;
+    }
+
+private:
+    struct CounterState
+    {
+        uint64_t current = 0;
+        uint64_t previous = 0;
+    };
+
+    std::vector<const MetricsRegistry *> registries_;
+    std::map<std::string, CounterState, std::less<>> counters_;
+    std::map<std::string, int64_t, std::less<>> gauges_;
+    std::map<std::string, LatencySummary, std::less<>> histograms_;
+    // Previous cumulative buckets of every (thread, histogram) seen
+    std::map<const LatencyHistogram *, std::unique_ptr<std::array<uint64_t, LatencyHistogram::BUCKETS>>> previous_;
+    std::unique_ptr<LatencyInterval> interval_ = std::make_unique<LatencyInterval>();
+
+    void collectHistograms()
+    {
+        // Names over all registries, each merged once
+        std::vector<std::string> names;
+        for (const MetricsRegistry *registry : registries_)
+        {
+            for (const auto &name : registry->histogramNames())
+            {
+                if (std::find(names.begin(), names.end(), name) == names.end())
+                    names.push_back(name);
+            }
+        }
+
+        for (const auto &name : names)
+        {
+            interval_->clear();
+            for (const MetricsRegistry *registry : registries_)
+            {
+                const auto &registryNames = registry->histogramNames();
+                auto it = std::find(registryNames.begin(), registryNames.end(), name);
+                if (it == registryNames.end())
+                    continue;
+                std::size_t id = static_cast<std::size_t>(it - registryNames.begin());
+                for (const auto &thread : registry->threads())
+                {
+                    LatencyHistogram &histogram = thread->histogram(id);
+                    auto &previous = previous_[&histogram];
+                    if (!previous)
+                        previous = std::make_unique<std::array<uint64_t, LatencyHistogram::BUCKETS>>();
+                    interval_->add(histogram, *previous);
+                }
+            }
+            histograms_[name] = interval_->summary();
+        }
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_METRICS_REGISTRY_H
@@ -0,0 +1,310 @@
+#ifndef MARKET_DATA_SYSTEM_RATE_CONTROLLER_H
+#define MARKET_DATA_SYSTEM_RATE_CONTROLLER_H
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include <core/tsc_clock.h>
+#include <core/tsc_pacer.h>
+
+/**
+ * @brief Target message rate over time, piecewise linear.
+ *
+ * Each segment runs its rate linearly from startRate to endRate over
+ * durationNs (equal rates = constant). After the last segment the profile
+ * either repeats from the start or holds the last endRate forever.
+ * Rates are messages / second, times are ns from the start of the run.
+ */
+struct RateSegment
+{
+    double durationNs;
+    double startRate;
+    double endRate;
+};
+
+class RateProfile
+{
+public:
+    RateProfile(std::vector<RateSegment> segments, bool repeat)
+        : segments_{std::move(segments)},
+          repeat_{repeat}
+    {
+        if (segments_.empty())
+            throw std::invalid_argument("RateProfile: no segments");
+        for (const auto &segment : segments_)
+        {
+            if (segment.durationNs <= 0.0 || segment.startRate < 0.0 || segment.endRate < 0.0)
+                throw std::invalid_argument("RateProfile: segments need a positive duration and non-negative rates");
+            periodNs_ += segment.durationNs;
+            periodCount_ += integral(segment, segment.durationNs);
+        }
+        if (periodCount_ <= 0.0 || (!repeat_ && segments_.back().endRate <= 0.0))
+            throw std::invalid_argument("RateProfile: profile must keep sending (non-zero final or repeating rate)");
+    }
+
+    // Target rate (messages / second) at time tNs
+    double rateAt(double tNs) const
+    {
+        auto [segment, offset] = locate(tNs);
+        if (!segment)
+            return segments_.back().endRate;
+        return segment->startRate + (segment->endRate - segment->startRate) * (offset / segment->durationNs);
+    }
+
+    // Messages the profile asks for in [0, tNs)
+    double expectedCount(double tNs) const
+    {
+        double count = 0.0;
+        if (repeat_)
+        {
+            double periods = std::floor(tNs / periodNs_);
+            count += periods * periodCount_;
+            tNs -= periods * periodNs_;
+        }
+        for (const auto &segment : segments_)
+        {
+            if (tNs <= 0.0)
+                return count;
+            double span = std::min(tNs, segment.durationNs);
+            count += integral(segment, span);
+            tNs -= span;
+        }
+        // Past the end of a non-repeating profile: hold the last rate
+        return count + std::max(tNs, 0.0) * segments_.back().endRate / 1e9;
+    }
+
+    /**
+     * @brief Time of the release one message after tNs.
+     *
+     * Walks forward until the area under the rate curve reaches one message,
+     * solving the linear segment exactly, so ramps starting from zero and
+     * idle (zero-rate) stretches between bursts need no special casing.
+     */
+    double nextReleaseNs(double tNs) const
+    {
+        double need = 1e9; // One message, in (messages / second) * ns
+        while (true)
+        {
+            auto [segment, offset] = locate(tNs);
+            if (!segment)
+                return tNs + need / segments_.back().endRate;
+
+            double remainingNs = segment->durationNs - offset;
+            double slope = (segment->endRate - segment->startRate) / segment->durationNs;
+            double rate = segment->startRate + slope * offset;
+            double available = (rate + segment->endRate) * 0.5 * remainingNs;
+            if (available >= need)
+            {
+                // rate * dt + slope * dt^2 / 2 = need, in the cancellation-free form
+                return tNs + 2.0 * need / (rate + std::sqrt(std::max(rate * rate + 2.0 * slope * need, 0.0)));
+            }
+            need -= available;
+            double next = tNs + remainingNs;
+            tNs = (next > tNs) ? next : std::nextafter(tNs, next + 1.0); // Always make progress at large t
+        }
+    }
+
+private:
+    std::vector<RateSegment> segments_;
+    bool repeat_;
+    double periodNs_ = 0.0;
+    double periodCount_ = 0.0; // Messages in one pass over the segments
+
+    // Messages sent in the first spanNs of a segment (area under the rate line)
+    static double integral(const RateSegment &segment, double spanNs)
+    {
+        double rateAtSpan = segment.startRate + (segment.endRate - segment.startRate) * (spanNs / segment.durationNs);
+        return 0.5 * (segment.startRate + rateAtSpan) * spanNs / 1e9;
+    }
+
+    // Segment containing tNs and the offset into it (nullptr = past a non-repeating profile)
+    std::pair<const RateSegment *, double> locate(double tNs) const
+    {
+        if (repeat_)
+            tNs = std::fmod(tNs, periodNs_);
+        for (const auto &segment : segments_)
+        {
+            if (tNs < segment.durationNs)
+                return {&segment, tNs};
+            tNs -= segment.durationNs;
+        }
+        return {nullptr, 0.0};
+    }
+};
+
+inline bool isRateProfileSpec(std::string_view spec)
+{
+    std::string_view kind = spec.substr(0, spec.find(':'));
+    return kind == "constant" || kind == "step" || kind == "ramp" || kind == "burst";
+}
+
+/**
+ * @brief Builds a rate profile from a short spec string.
+ *
+ *   "constant:<rate>"                             -> <rate> forever
+ *   "step:<rate>:<secs>[:<rate>:<secs>...]"       -> each rate for its duration, last one held
+ *   "ramp:<from>:<to>:<secs>"                     -> linear ramp, <to> held afterwards
+ *   "burst:<base>:<peak>:<burst_ms>:<period_ms>"  -> <peak> for burst_ms of every period_ms, <base> otherwise
+ *
+ * Rates are messages / second. Throws std::invalid_argument on a bad spec.
+ */
+inline RateProfile makeRateProfile(std::string_view spec)
+{
+    constexpr double NS_PER_SEC = 1e9;
+    constexpr double NS_PER_MS = 1e6;
+
+    std::vector<double> args;
+    std::size_t start = spec.find(':');
+    std::string_view kind = spec.substr(0, start);
+    while (start != std::string_view::npos)
+    {
+        std::size_t end = spec.find(':', start + 1);
+        args.push_back(std::stod(std::string(spec.substr(start + 1, end == std::string_view::npos ? end : end - start - 1))));
+        start = end;
+    }
+
+    if (kind == "constant" && args.size() == 1)
+    {
+        return RateProfile({{NS_PER_SEC, args[0], args[0]}}, false);
+    }
+    if (kind == "step" && !args.empty() && args.size() % 2 == 0)
+    {
+        std::vector<RateSegment> segments;
+        for (std::size_t i = 0; i < args.size(); i += 2)
+        {
+            segments.push_back({args[i + 1] * NS_PER_SEC, args[i], args[i]});
+        }
+        return RateProfile(std::move(segments), false);
+    }
+    if (kind == "ramp" && args.size() == 3)
+    {
+        return RateProfile({{args[2] * NS_PER_SEC, args[0], args[1]}}, false);
+    }
+    if (kind == "burst" && args.size() == 4 && args[3] > args[2])
+    {
+        return RateProfile({{args[2] * NS_PER_MS, args[1], args[1]}, {(args[3] - args[2]) * NS_PER_MS, args[0], args[0]}}, true);
+    }
+    throw std::invalid_argument("Unknown rate spec '" + std::string(spec) +
+                                "' (expected constant:<rate>, step:<rate>:<secs>..., ramp:<from>:<to>:<secs> or burst:<base>:<peak>:<burst_ms>:<period_ms>)");
+}
+
+// One monitor window of a RateController
+struct RateSample
+{
+    double targetRate;   // Messages / second the profile asked for over the window
+    double achievedRate; // Messages / second actually released
+    double lagNs;        // Schedule lag of the last release
+    double maxLagNs;     // Worst schedule lag in the window
+};
+
+/**
+ * @brief Releases messages on a deadline schedule that follows a RateProfile.
+ *
+ * The next deadline is where the profile's cumulative count reaches one
+ * more message after the previous deadline, so the schedule is absolute and never drifts with wake-up jitter. A sender that
+ * falls behind catches up in a burst, but only up to maxBacklogNs of debt
+ * (the token bucket depth); older debt is forgiven so a stall does not turn
+ * into an unbounded line-rate burst afterwards.
+ *
+ * acquire() is called by one producer thread, sample() by one monitor thread.
+ */
+class RateController
+{
+public:
+    static constexpr double DEFAULT_MAX_BACKLOG_NS = 1'000'000.0; // 1ms
+
+    explicit RateController(RateProfile profile, double maxBacklogNs = DEFAULT_MAX_BACKLOG_NS)
+        : profile_{std::move(profile)},
+          maxBacklogNs_{maxBacklogNs},
+          ticksPerNs_{TscClock::ticksPerNs()}
+    {
+        start();
+    }
+
+    // Restart the schedule (and the monitor window) from "now"
+    void start()
+    {
+        epoch_ = TscClock::now();
+        nextNs_ = 0.0;
+        released_.store(0, std::memory_order_relaxed);
+        sampleTsc_ = epoch_;
+        sampleReleased_ = 0;
+    }
+
+    /**
+     * @brief Block until the next message may go.
+     * @return Schedule lag of this release in ns (0 or positive).
+     */
+    double acquire()
+    {
+        // Token bucket: forgive debt older than maxBacklogNs
+        double nowNs = static_cast<double>(TscClock::now() - epoch_) / ticksPerNs_;
+        if (nowNs - nextNs_ > maxBacklogNs_)
+        {
+            nextNs_ = nowNs - maxBacklogNs_;
+        }
+
+        const double deadlineNs = nextNs_;
+        nextNs_ = profile_.nextReleaseNs(deadlineNs);
+
+        double lagNs = TscPacer::waitUntil(epoch_ + static_cast<uint64_t>(deadlineNs * ticksPerNs_), ticksPerNs_);
+
+        // Single writer: plain store, no locked RMW
+        released_.store(released_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        lastLagNs_.store(lagNs, std::memory_order_relaxed);
+        if (lagNs > maxLagNs_.load(std::memory_order_relaxed))
+            maxLagNs_.store(lagNs, std::memory_order_relaxed);
+        return lagNs;
+    }
+
+    // Target vs achieved since the previous sample() (monitor thread)
+    RateSample sample()
+    {
+        uint64_t now = TscClock::now();
+        uint64_t released = released_.load(std::memory_order_relaxed);
+
+        double fromNs = static_cast<double>(sampleTsc_ - epoch_) / ticksPerNs_;
+        double toNs = static_cast<double>(now - epoch_) / ticksPerNs_;
+        double seconds = (toNs - fromNs) / 1e9;
+
+        RateSample result{};
+        if (seconds > 0.0)
+        {
+            result.targetRate = (profile_.expectedCount(toNs) - profile_.expectedCount(fromNs)) / seconds;
+            result.achievedRate = static_cast<double>(released - sampleReleased_) / seconds;
+        }
+        result.lagNs = lastLagNs_.load(std::memory_order_relaxed);
+        result.maxLagNs = maxLagNs_.exchange(0.0, std::memory_order_relaxed);
+
+        sampleTsc_ = now;
+        sampleReleased_ = released;
+        return result;
+    }
+
+    const RateProfile &profile() const { return profile_; }
+
+private:
+    RateProfile profile_;
+    double maxBacklogNs_;
+    double ticksPerNs_;
+
+    // --- Producer side ---
+    uint64_t epoch_ = 0;
+    double nextNs_ = 0.0; // Deadline of the next release, ns from epoch_
+    alignas(64) std::atomic<uint64_t> released_{0};
+    std::atomic<double> lastLagNs_{0.0};
+    std::atomic<double> maxLagNs_{0.0};
+
+    // --- Monitor side ---
+    alignas(64) uint64_t sampleTsc_ = 0;
+    uint64_t sampleReleased_ = 0;
+};
+
+#endif // MARKET_DATA_SYSTEM_RATE_CONTROLLER_H
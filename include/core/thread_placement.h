@@ -0,0 +1,260 @@
+#ifndef MARKET_DATA_SYSTEM_THREAD_PLACEMENT_H
+#define MARKET_DATA_SYSTEM_THREAD_PLACEMENT_H
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include <core/async_logger.h>
+
+#ifdef __linux__
+#include <pthread.h> // For pthread_setaffinity_np(), pthread_setname_np(), pthread_setschedparam()
+#include <sched.h>   // For sched_getcpu(), SCHED_FIFO
+#endif
+
+/**
+ * @file thread_placement.h
+ * @brief Where each pipeline thread runs: CPU set, scheduling class and name.
+ *
+ * Hot threads (producer, encoder, consumer) belong on isolated cores (isolcpus= /
+ * nohz_full=) so nothing else - including the monitor's output - is
+ * scheduled next to them. checkThreadPlacement() runs once at startup on
+ * the launching thread, applyThreadPlacement() runs first thing on each
+ * placed thread.
+ */
+
+/**
+ * @brief Parses a kernel cpulist ("3", "2-5", "0,2-3,8").
+ * Throws std::invalid_argument on a malformed list.
+ */
+inline std::vector<int> parseCpuList(std::string_view list)
+{
+    std::vector<int> cpus;
+    while (!list.empty() && list.back() == '\n')
+        list.remove_suffix(1);
+
+    std::size_t start = 0;
+    while (start < list.size())
+    {
+        std::size_t end = list.find(',', start);
+        if (end == std::string_view::npos)
+            end = list.size();
+        std::string range(list.substr(start, end - start));
+        start = end + 1;
+
+        try
+        {
+            std::size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            if (first < 0 || last < first)
+                throw std::invalid_argument(range);
+            for (int cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        }
+        catch (const std::exception &)
+        {
+            throw std::invalid_argument("Bad CPU list '" + std::string(list) + "'");
+        }
+    }
+    return cpus;
+}
+
+// CPUs removed from the general scheduler at boot (isolcpus=), empty if none / not Linux
+inline std::vector<int> isolatedCpus()
+{
+    std::ifstream in("/sys/devices/system/cpu/isolated");
+    std::string line;
+    if (!in || !std::getline(in, line))
+        return {};
+    return parseCpuList(line);
+}
+
+inline std::string formatCpuList(const std::vector<int> &cpus)
+{
+    std::string out;
+    for (int cpu : cpus)
+        out += (out.empty() ? "" : ",") + std::to_string(cpu);
+    return out.empty() ? "any" : out;
+}
+
+// Placement of one thread role
+struct ThreadRole
+{
+    std::vector<int> cpus; // Empty = leave it to the OS
+    int fifoPriority = 0;  // 1..99 = SCHED_FIFO at that priority, 0 = normal (SCHED_OTHER)
+    bool hot = false;      // Latency-critical, expected on an isolated core
+};
+
+/**
+ * @brief Placement of the pipeline's thread roles.
+ *
+ * Filled from the command line with fromArgs(), shared by the producers,
+ * latency_benchmark and stress_test_jitter:
+ *
+ *   --pin-producer <cpulist>  --pin-consumer <cpulist>  --pin-monitor <cpulist>
+ *   --pin-encoder <cpulist>   encoder thread of a three-stage pipeline (the consumer then only sends)
+ *   --fifo <priority>         SCHED_FIFO for the hot threads (producer, encoder, consumer)
+ *   --require-isolated        refuse to start unless hot threads are pinned to isolated CPUs
+ */
+struct ThreadPlacement
+{
+    ThreadRole producer{{}, 0, true};
+    ThreadRole consumer{{}, 0, true};
+    ThreadRole encoder{{}, 0, true}; // Three-stage pipelines only
+    ThreadRole monitor{};
+    bool requireIsolated = false;
+
+    /**
+     * @brief Consumes the placement flags from argv (in place) and returns them.
+     *
+     * argc / argv are compacted to the remaining arguments, so a main can
+     * parse its positional arguments exactly as before.
+     */
+    static ThreadPlacement fromArgs(int &argc, char **argv)
+    {
+        ThreadPlacement placement;
+        int kept = 1;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string_view arg = argv[i];
+            auto value = [&]() -> std::string_view
+            {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument(std::string(arg) + " needs a value");
+                return argv[++i];
+            };
+
+            if (arg == "--pin-producer")
+                placement.producer.cpus = parseCpuList(value());
+            else if (arg == "--pin-consumer")
+                placement.consumer.cpus = parseCpuList(value());
+            else if (arg == "--pin-encoder")
+                placement.encoder.cpus = parseCpuList(value());
+            else if (arg == "--pin-monitor")
+                placement.monitor.cpus = parseCpuList(value());
+            else if (arg == "--fifo")
+                placement.producer.fifoPriority = placement.consumer.fifoPriority = placement.encoder.fifoPriority =
+                    std::stoi(std::string(value()));
+            else if (arg == "--require-isolated")
+                placement.requireIsolated = true;
+            else
+                argv[kept++] = argv[i];
+        }
+        argc = kept;
+        return placement;
+    }
+};
+
+/**
+ * @brief Startup check of one role against the machine (call before launching it).
+ *
+ * Warns when a hot role is pinned outside the isolated set; with
+ * requireIsolated that (or leaving it unpinned) is an error instead.
+ * Unknown CPUs and bad priorities always throw.
+ */
+inline void checkThreadPlacement(std::string_view name, const ThreadRole &role, bool requireIsolated)
+{
+#ifdef __linux__
+    const int online = static_cast<int>(std::thread::hardware_concurrency());
+    for (int cpu : role.cpus)
+    {
+        if (cpu >= CPU_SETSIZE || (online > 0 && cpu >= online))
+            throw std::invalid_argument(std::string(name) + ": CPU " + std::to_string(cpu) + " does not exist");
+    }
+    if (role.fifoPriority < 0 || role.fifoPriority > 99)
+        throw std::invalid_argument(std::string(name) + ": SCHED_FIFO priority must be 1..99");
+#endif
+
+    // Unpinned and not required: the OS decides, nothing to check
+    if (!role.hot || (role.cpus.empty() && !requireIsolated))
+        return;
+
+    const std::vector<int> isolated = isolatedCpus();
+    bool onIsolated = !role.cpus.empty() && std::all_of(role.cpus.begin(), role.cpus.end(), [&](int cpu)
+                                                        { return std::find(isolated.begin(), isolated.end(), cpu) != isolated.end(); });
+    if (onIsolated)
+        return;
+
+    std::string message = std::string(name) + " on CPU(s) " + formatCpuList(role.cpus) +
+                          ", isolated CPU(s): " + (isolated.empty() ? std::string("none") : formatCpuList(isolated));
+    if (requireIsolated)
+        throw std::runtime_error("[Placement] hot thread not isolated: " + message);
+    logWarn("[Placement] Warning: hot thread not on an isolated core: {}", message);
+}
+
+// withEncoder: the pipeline runs an encoder thread (three-stage), check its role too
+inline void checkThreadPlacement(const ThreadPlacement &placement, bool withEncoder = false)
+{
+    checkThreadPlacement("producer", placement.producer, placement.requireIsolated);
+    checkThreadPlacement("consumer", placement.consumer, placement.requireIsolated);
+    if (withEncoder)
+        checkThreadPlacement("encoder", placement.encoder, placement.requireIsolated);
+    checkThreadPlacement("monitor", placement.monitor, placement.requireIsolated);
+}
+
+/**
+ * @brief Names, pins and schedules the calling thread.
+ *
+ * Runs on the placed thread itself. Failures are reported rather than
+ * thrown (the thread keeps running unplaced): SCHED_FIFO in particular
+ * needs CAP_SYS_NICE or an rtprio limit.
+ * @return true if every requested setting was applied.
+ */
+inline bool applyThreadPlacement(std::string_view name, const ThreadRole &role)
+{
+#ifdef __linux__
+    bool ok = true;
+    pthread_t self = pthread_self();
+
+    // Kernel thread names are limited to 15 characters
+    std::string shortName(name.substr(0, 15));
+    pthread_setname_np(self, shortName.c_str());
+
+    if (!role.cpus.empty())
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : role.cpus)
+            CPU_SET(cpu, &set);
+        int rc = pthread_setaffinity_np(self, sizeof(set), &set);
+        if (rc != 0)
+        {
+            logWarn("[Placement] {}: pthread_setaffinity_np failed: {}", shortName, std::strerror(rc));
+            ok = false;
+        }
+        else if (std::find(role.cpus.begin(), role.cpus.end(), sched_getcpu()) == role.cpus.end())
+        {
+            // Migration happens at the next scheduling point, yield once to take it
+            sched_yield();
+        }
+    }
+
+    if (role.fifoPriority > 0)
+    {
+        sched_param param{};
+        param.sched_priority = role.fifoPriority;
+        int rc = pthread_setschedparam(self, SCHED_FIFO, &param);
+        if (rc != 0)
+        {
+            logWarn("[Placement] {}: SCHED_FIFO {} failed: {}", shortName, role.fifoPriority, std::strerror(rc));
+            ok = false;
+        }
+    }
+
+    logInfo("[Placement] {} running on CPU {} (allowed {}{})", shortName, sched_getcpu(), formatCpuList(role.cpus),
+            role.fifoPriority > 0 ? ", SCHED_FIFO " + std::to_string(role.fifoPriority) : std::string());
+    return ok;
+#else
+    (void)name;
+    (void)role;
+    return role.cpus.empty() && role.fifoPriority == 0; // Placement not supported on this platform
+#endif
+}
+
+#endif // MARKET_DATA_SYSTEM_THREAD_PLACEMENT_H
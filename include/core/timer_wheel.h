@@ -0,0 +1,237 @@
+#ifndef MARKET_DATA_SYSTEM_TIMER_WHEEL_H
+#define MARKET_DATA_SYSTEM_TIMER_WHEEL_H
+
+#include <array>
+#include <bit>
+#include <coroutine>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Timer entry. Owned by the caller (typically lives inside a
+ * coroutine frame), the wheel only stores its address.
+ */
+struct TimerNode
+{
+    uint64_t deadline = 0; // In wheel ticks
+    std::coroutine_handle<> handle;
+};
+
+/**
+ * @brief Hierarchical timer wheel (Varghese & Lauck), 6 levels x 256 slots.
+ *
+ * Level L slot s holds timers whose deadline shares every bit above 8*(L+1)
+ * with the current tick and has s in bits [8L, 8L+8). Level 0 therefore
+ * holds timers due within the current 256-tick window, one slot per tick.
+ * When the current tick enters a higher-level slot that slot is cascaded
+ * (its timers re-inserted one level down).
+ *
+ * schedule() is O(1). Each timer is cascaded at most LEVELS - 1 times, so
+ * firing is amortised O(1) as well. Per-level occupancy bitmaps let
+ * advance() / fireNext() skip empty stretches without walking every tick,
+ * which is what makes virtual-time runs cheap.
+ *
+ * Range: 2^48 ticks ahead of the current tick (~9 years at 1us resolution).
+ */
+class TimerWheel
+{
+public:
+    static constexpr unsigned SLOT_BITS = 8;
+    static constexpr std::size_t SLOTS = std::size_t{1} << SLOT_BITS;
+    static constexpr unsigned LEVELS = 6;
+    static constexpr uint64_t NO_TIMER = std::numeric_limits<uint64_t>::max();
+
+    explicit TimerWheel(uint64_t startTick = 0) : current_{startTick} {}
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    /**
+     * @brief Links node into the wheel. Deadlines in the past fire on the next tick processed.
+     */
+    void schedule(TimerNode *node)
+    {
+        if (node->deadline < current_)
+            node->deadline = current_;
+        insert(node);
+        ++size_;
+    }
+
+    /**
+     * @brief Fires every timer with deadline <= now, in deadline order.
+     *
+     * @param fire  void(TimerNode *). May re-schedule the node (or others).
+     * @return Number of timers fired
+     */
+    template <typename FireFn>
+    std::size_t advance(uint64_t now, FireFn &&fire)
+    {
+        std::size_t fired = 0;
+        while (true)
+        {
+            uint64_t tick = nextTick();
+            if (tick > now)
+                break;
+            current_ = tick;
+            fired += processTick(fire);
+        }
+        // Nothing pending up to now, so no cascade boundary is skipped
+        if (current_ <= now)
+            current_ = now + 1;
+        return fired;
+    }
+
+    /**
+     * @brief Jumps straight to the earliest pending tick and fires it (virtual time).
+     * @return Number of timers fired, 0 when the wheel is empty or the next timer is past limit
+     */
+    template <typename FireFn>
+    std::size_t fireNext(FireFn &&fire, uint64_t limit = NO_TIMER)
+    {
+        while (size_ > 0)
+        {
+            const uint64_t tick = nextTick();
+            if (tick > limit)
+                return 0;
+            current_ = tick;
+            if (std::size_t fired = processTick(fire))
+                return fired;
+        }
+        return 0;
+    }
+
+    // Next tick that has work (a due timer or an occupied cascade boundary)
+    uint64_t nextTick() const
+    {
+        // 1. A higher-level slot covering the current tick still has to cascade.
+        //    Timers re-scheduled mid-fire can land in level 0 ahead of it, so it goes first.
+        for (unsigned level = 1; level < LEVELS; ++level)
+        {
+            if (isOccupied(level, (current_ >> (level * SLOT_BITS)) & (SLOTS - 1)))
+                return current_;
+        }
+
+        // 2. Earliest occupied slot ahead, lowest level first
+        for (unsigned level = 0; level < LEVELS; ++level)
+        {
+            const unsigned shift = level * SLOT_BITS;
+            const std::size_t index = (current_ >> shift) & (SLOTS - 1);
+            const std::size_t slot = nextOccupied(level, index);
+            if (slot != SLOTS)
+            {
+                uint64_t start = (((current_ >> shift) - index) + slot) << shift;
+                return start > current_ ? start : current_;
+            }
+        }
+        return NO_TIMER;
+    }
+
+    // Next tick to be processed (all earlier ticks have fired)
+    uint64_t current() const { return current_; }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    // Slots are arrays of node pointers rather than intrusive lists: cascading
+    // and firing walk them with the next nodes already prefetched instead of
+    // chasing one cache miss after another.
+    using Slot = std::vector<TimerNode *>;
+    static constexpr std::size_t PREFETCH_DISTANCE = 4;
+
+    std::array<std::array<Slot, SLOTS>, LEVELS> slots_{};
+    std::array<std::array<uint64_t, SLOTS / 64>, LEVELS> occupied_{};
+    Slot scratch_; // Swapped with a slot being drained, keeps both capacities warm
+    uint64_t current_;
+    std::size_t size_ = 0;
+
+    void insert(TimerNode *node)
+    {
+        // Highest bit where deadline and current differ picks the level
+        const uint64_t diff = node->deadline ^ current_;
+        const unsigned level = diff < SLOTS ? 0 : (std::bit_width(diff) - 1) / SLOT_BITS;
+        if (level >= LEVELS)
+        {
+            throw std::out_of_range("TimerWheel: deadline beyond wheel range");
+        }
+        const std::size_t index = (node->deadline >> (level * SLOT_BITS)) & (SLOTS - 1);
+
+        // Appending keeps same-tick timers in scheduling order
+        slots_[level][index].push_back(node);
+        occupied_[level][index / 64] |= uint64_t{1} << (index % 64);
+    }
+
+    // Moves the slot's contents into scratch_ and marks it empty
+    void detach(unsigned level, std::size_t index)
+    {
+        scratch_.clear();
+        scratch_.swap(slots_[level][index]);
+        occupied_[level][index / 64] &= ~(uint64_t{1} << (index % 64));
+    }
+
+    bool isOccupied(unsigned level, std::size_t index) const
+    {
+        return (occupied_[level][index / 64] >> (index % 64)) & 1;
+    }
+
+    // First occupied slot >= from at this level, SLOTS if none
+    std::size_t nextOccupied(unsigned level, std::size_t from) const
+    {
+        std::size_t word = from / 64;
+        uint64_t bits = occupied_[level][word] & (~uint64_t{0} << (from % 64));
+        while (true)
+        {
+            if (bits)
+                return word * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+            if (++word == SLOTS / 64)
+                return SLOTS;
+            bits = occupied_[level][word];
+        }
+    }
+
+    template <typename FireFn>
+    std::size_t processTick(FireFn &fire)
+    {
+        const uint64_t tick = current_;
+
+        // 1. Cascade every higher-level slot covering this tick, top down
+        for (unsigned level = LEVELS - 1; level > 0; --level)
+        {
+            const std::size_t index = (tick >> (level * SLOT_BITS)) & (SLOTS - 1);
+            if (!isOccupied(level, index))
+                continue;
+            detach(level, index);
+            for (std::size_t i = 0; i < scratch_.size(); ++i)
+            {
+                if (i + PREFETCH_DISTANCE < scratch_.size())
+                    __builtin_prefetch(scratch_[i + PREFETCH_DISTANCE]);
+                insert(scratch_[i]);
+            }
+        }
+
+        // 2. Fire this tick's slot. current_ moves on first so anything
+        //    re-scheduled for <= tick lands in the next tick, not this slot.
+        detach(0, tick & (SLOTS - 1));
+        current_ = tick + 1;
+
+        // fire() may schedule into any slot, so work from a private copy
+        Slot due;
+        due.swap(scratch_);
+        const std::size_t fired = due.size();
+        size_ -= fired;
+        for (std::size_t i = 0; i < fired; ++i)
+        {
+            if (i + PREFETCH_DISTANCE < fired)
+                __builtin_prefetch(due[i + PREFETCH_DISTANCE]);
+            fire(due[i]);
+        }
+        due.clear();
+        due.swap(scratch_);
+        return fired;
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_TIMER_WHEEL_H
@@ -0,0 +1,84 @@
+#ifndef MARKET_DATA_SYSTEM_TSC_CLOCK_H
+#define MARKET_DATA_SYSTEM_TSC_CLOCK_H
+
+#include <cstdint>
+#include <chrono>
+#include <thread>
+
+// --- ARCHITECTURE DETECTION ---
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#include <x86intrin.h> // For __rdtsc()
+#endif
+
+/**
+ * @brief Raw cycle counter read (TSC on x86_64, virtual counter on ARM64).
+ *
+ * Falls back to steady_clock nanoseconds elsewhere, in which case the
+ * calibrated rate below simply comes out as ~1 tick per ns.
+ */
+inline uint64_t readTsc() noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return __rdtsc();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    uint64_t val;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(val));
+    return val;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+inline void cpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief Converts between cycle-counter ticks and nanoseconds.
+ *
+ * The tick rate is measured once against steady_clock (first use, ~20ms spin)
+ * and shared by every caller afterwards.
+ */
+class TscClock
+{
+public:
+    static uint64_t now() noexcept { return readTsc(); }
+
+    static double ticksPerNs()
+    {
+        static const double rate = calibrate();
+        return rate;
+    }
+
+    static double toNs(uint64_t ticks) { return static_cast<double>(ticks) / ticksPerNs(); }
+    static uint64_t fromNs(double ns) { return static_cast<uint64_t>(ns * ticksPerNs()); }
+
+private:
+    static double calibrate()
+    {
+        using clock = std::chrono::steady_clock;
+        constexpr auto CALIBRATION_WINDOW = std::chrono::milliseconds(20);
+
+        auto wallStart = clock::now();
+        uint64_t tscStart = readTsc();
+        while (clock::now() - wallStart < CALIBRATION_WINDOW)
+        {
+            cpuRelax();
+        }
+        uint64_t tscEnd = readTsc();
+        auto wallEnd = clock::now();
+
+        double elapsedNs = std::chrono::duration<double, std::nano>(wallEnd - wallStart).count();
+        return static_cast<double>(tscEnd - tscStart) / elapsedNs;
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_TSC_CLOCK_H
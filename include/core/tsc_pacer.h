@@ -0,0 +1,87 @@
+#ifndef MARKET_DATA_SYSTEM_TSC_PACER_H
+#define MARKET_DATA_SYSTEM_TSC_PACER_H
+
+#include <cstdint>
+#include <chrono>
+#include <thread>
+
+#include <core/tsc_clock.h>
+
+/**
+ * @brief Releases events on an absolute TSC schedule.
+ *
+ * Each wait() advances the deadline by the given inter-arrival time and
+ * blocks until the TSC passes it. Deadlines accumulate from the start epoch,
+ * never from the actual wake-up, so scheduler jitter does not turn into rate
+ * drift. Long gaps sleep in the OS first and only spin the last
+ * SPIN_THRESHOLD, short gaps (microbursts) are spin-only.
+ */
+class TscPacer
+{
+public:
+    // Below this the OS sleep granularity is worse than spinning
+    static constexpr double SPIN_THRESHOLD_NS = 100'000.0;
+
+    TscPacer() : ticksPerNs_{TscClock::ticksPerNs()}
+    {
+        reset();
+    }
+
+    // Restart the schedule from "now"
+    void reset()
+    {
+        epoch_ = TscClock::now();
+        offset_ = 0.0;
+    }
+
+    /**
+     * @brief Wait until the next event, intervalNs after the previous deadline.
+     * @return How late the release was in ns (0 or positive).
+     */
+    double wait(double intervalNs)
+    {
+        offset_ += intervalNs * ticksPerNs_;
+        const uint64_t deadlineTicks = deadline();
+
+        return waitUntil(deadlineTicks, ticksPerNs_);
+    }
+
+    /**
+     * @brief Block until the TSC passes deadlineTicks (sleep, then spin the last SPIN_THRESHOLD).
+     * @return How late the release was in ns (0 or positive).
+     */
+    static double waitUntil(uint64_t deadlineTicks, double ticksPerNs)
+    {
+        uint64_t now = TscClock::now();
+        if (now >= deadlineTicks)
+        {
+            // Behind schedule: release immediately (burst to catch up)
+            return static_cast<double>(now - deadlineTicks) / ticksPerNs;
+        }
+
+        // 1. Coarse OS sleep for long gaps
+        double remainingNs = static_cast<double>(deadlineTicks - now) / ticksPerNs;
+        if (remainingNs > SPIN_THRESHOLD_NS)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(static_cast<int64_t>(remainingNs - SPIN_THRESHOLD_NS)));
+        }
+
+        // 2. Fine spin on the TSC
+        while ((now = TscClock::now()) < deadlineTicks)
+        {
+            cpuRelax();
+        }
+
+        return static_cast<double>(now - deadlineTicks) / ticksPerNs;
+    }
+
+    // Absolute deadline of the last released event, in TSC ticks
+    uint64_t deadline() const { return epoch_ + static_cast<uint64_t>(offset_); }
+
+private:
+    double ticksPerNs_;
+    uint64_t epoch_;
+    double offset_; // Fractional ticks since epoch_ so sub-tick intervals do not truncate away
+};
+
+#endif // MARKET_DATA_SYSTEM_TSC_PACER_H
@@ -0,0 +1,30 @@
+#ifndef MARKET_DATA_SYSTEM_WAIT_STRATEGY_H
+#define MARKET_DATA_SYSTEM_WAIT_STRATEGY_H
+
+#include <thread>
+
+#include <core/tsc_clock.h>
+
+/**
+ * @file wait_strategy.h
+ * @brief What a hot thread does while its queue is full (producer) or empty (consumer).
+ *
+ * Static policies so the engine's retry loops inline them. Only used with
+ * non-blocking queues, a blocking queue parks the thread itself.
+ */
+
+// Give the core away (polite, the default of the original non-blocking systems)
+struct YieldWait
+{
+    static void idle() noexcept { std::this_thread::yield(); }
+    static constexpr const char *name() { return "Yield"; }
+};
+
+// Stay on the core with a pause hint (lowest wake-up latency, burns the core)
+struct SpinWait
+{
+    static void idle() noexcept { cpuRelax(); }
+    static constexpr const char *name() { return "Spin"; }
+};
+
+#endif // MARKET_DATA_SYSTEM_WAIT_STRATEGY_H
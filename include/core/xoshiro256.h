@@ -0,0 +1,87 @@
+#ifndef MARKET_DATA_SYSTEM_XOSHIRO256_H
+#define MARKET_DATA_SYSTEM_XOSHIRO256_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief xoshiro256++ PRNG (Blackman & Vigna) with jump-ahead.
+ *
+ * Satisfies UniformRandomBitGenerator so it plugs into <random> distributions.
+ * jump() advances the state by 2^128 draws, so stream k = seed + k jumps never
+ * overlaps stream k+1 for any realistic run length. That is what lets a
+ * parallel generator hand every instrument its own stream and still produce
+ * identical output no matter how instruments are split across threads.
+ */
+class Xoshiro256PlusPlus
+{
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256PlusPlus(uint64_t seed = 0x9E3779B97F4A7C15ull)
+    {
+        // Expand the 64-bit seed with splitmix64 (recommended by the authors)
+        for (auto &word : state_)
+        {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept
+    {
+        const uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+        const uint64_t t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+
+        return result;
+    }
+
+    // Equivalent to 2^128 calls of operator()
+    void jump() noexcept
+    {
+        static constexpr uint64_t JUMP[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                            0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+        uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (uint64_t word : JUMP)
+        {
+            for (int b = 0; b < 64; ++b)
+            {
+                if (word & (uint64_t{1} << b))
+                {
+                    s0 ^= state_[0];
+                    s1 ^= state_[1];
+                    s2 ^= state_[2];
+                    s3 ^= state_[3];
+                }
+                (*this)();
+            }
+        }
+        state_[0] = s0;
+        state_[1] = s1;
+        state_[2] = s2;
+        state_[3] = s3;
+    }
+
+private:
+    uint64_t state_[4];
+
+    static constexpr uint64_t rotl(uint64_t x, int k) noexcept
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_XOSHIRO256_H
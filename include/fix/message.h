@@ -10,6 +10,8 @@
 #include <iterator>
 #include <format>
 #include <numeric>
+#include <algorithm>
+#include <cstddef>
 
 // FIX protocol uses 0x01 (Start of Heading) as the separator (pipe operator)
 constexpr char SOH = '\x01';
@@ -39,6 +41,13 @@ public:
         return *this;
     }
 
+    // Append an already rendered "tag=value<SOH>" field (e.g. SymbolRegistry::fixField)
+    FIXMessage &addRawField(std::span<const uint8_t> field)
+    {
+        bodyBuffer_.insert(bodyBuffer_.end(), field.begin(), field.end());
+        return *this;
+    }
+
     std::span<const uint8_t> finalize()
     {
         finalMessageBuffer_.clear();
@@ -82,6 +91,38 @@ public:
         return {finalMessageBuffer_.data(), finalMessageBuffer_.size()};
     }
 
+    /**
+     * Same bytes as finalize(), written straight into out (e.g. a ring
+     * reservation) instead of the internal buffer.
+     * Returns the message length, or 0 if it does not fit in out.
+     */
+    std::size_t finalizeInto(std::span<uint8_t> out) const
+    {
+        char length[24];
+        auto lengthEnd = std::format_to(length, "9={}{}", bodyBuffer_.size(), SOH);
+        const std::size_t lengthSize = static_cast<std::size_t>(lengthEnd - length);
+        const std::size_t headerSize = 2 + beginString_.size() + 1 + lengthSize;
+        const std::size_t total = headerSize + bodyBuffer_.size() + CHECKSUM_FIELD_SIZE;
+        if (total > out.size())
+            return 0;
+
+        // --- 1. Header: "8=FIX.4.2<SOH>9=SIZE<SOH>" ---
+        uint8_t *at = out.data();
+        *at++ = '8';
+        *at++ = '=';
+        at = std::copy(beginString_.begin(), beginString_.end(), at);
+        *at++ = SOH;
+        at = std::copy(length, lengthEnd, at);
+
+        // --- 2. Body ---
+        at = std::copy(bodyBuffer_.begin(), bodyBuffer_.end(), at);
+
+        // --- 3. Checksum over header + body, "10=XXX<SOH>" ---
+        unsigned int checkSum = std::accumulate(out.data(), at, 0u) % 256;
+        std::format_to(at, "10={:03}{}", checkSum, SOH);
+        return total;
+    }
+
     // Default move semantics
     FIXMessage(FIXMessage &&other) noexcept = default;
     FIXMessage &operator=(FIXMessage &&other) noexcept = default;
@@ -101,6 +142,8 @@ public:
     }
 
 private:
+    static constexpr std::size_t CHECKSUM_FIELD_SIZE = 7; // "10=XXX<SOH>"
+
     std::vector<uint8_t> bodyBuffer_;
 
     std::vector<uint8_t> finalMessageBuffer_;
@@ -0,0 +1,58 @@
+#ifndef MARKET_DATA_SYSTEM_SNAPSHOT_ENCODER_H
+#define MARKET_DATA_SYSTEM_SNAPSHOT_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <format>
+
+#include <fix/message.h>
+#include <market/market_tick.h>
+#include <market/symbol_registry.h>
+
+/**
+ * @brief Encoder policy: one tick -> FIX 4.2 35=W two-sided snapshot.
+ *
+ * Owns its FIXMessage so the body / final buffers are reused across ticks.
+ * The returned span is valid until the next encode(); encodeInto() writes
+ * the same bytes into caller-owned memory instead.
+ */
+class FixSnapshotEncoder
+{
+public:
+    explicit FixSnapshotEncoder(const SymbolRegistry &symbols)
+        : symbols_{symbols},
+          fixMessage_{"FIX.4.2"}
+    {
+    }
+
+    std::span<const uint8_t> encode(const MarketTick &tick)
+    {
+        buildBody(tick);
+        return fixMessage_.finalize();
+    }
+
+    // Encodes straight into out (e.g. a ByteRingBuffer reservation): bytes written, 0 = does not fit
+    std::size_t encodeInto(const MarketTick &tick, std::span<uint8_t> out)
+    {
+        buildBody(tick);
+        return fixMessage_.finalizeInto(out);
+    }
+
+    static constexpr const char *name() { return "FIX-W"; }
+
+private:
+    const SymbolRegistry &symbols_;
+    FIXMessage fixMessage_;
+
+    void buildBody(const MarketTick &tick)
+    {
+        fixMessage_.clearBody();
+        fixMessage_.addField(35, "W").addRawField(symbols_.fixField(tick.symbol_id)).addField(268, "2");
+        fixMessage_.addField(269, "0").addField(270, std::format("{:.2f}", tick.bid)).addField(271, std::to_string(tick.bid_size));
+        fixMessage_.addField(269, "1").addField(270, std::format("{:.2f}", tick.ask)).addField(271, std::to_string(tick.ask_size));
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_SNAPSHOT_ENCODER_H
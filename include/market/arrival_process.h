@@ -0,0 +1,172 @@
+#ifndef MARKET_DATA_SYSTEM_ARRIVAL_PROCESS_H
+#define MARKET_DATA_SYSTEM_ARRIVAL_PROCESS_H
+
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+/**
+ * @brief Tick arrival process interface
+ *
+ * Produces the gap (in nanoseconds) between consecutive tick emissions.
+ * Paired with TscPacer this replaces fixed sleep_for() pacing.
+ */
+class IArrivalProcess
+{
+public:
+    virtual ~IArrivalProcess() = default;
+
+    // Time from the previous event to the next one, in nanoseconds
+    virtual double nextInterArrivalNs() = 0;
+
+    // Long-run average event rate (events / second)
+    virtual double meanRate() const = 0;
+};
+
+/**
+ * @brief Homogeneous Poisson process: exponential inter-arrival times.
+ */
+class PoissonArrivalProcess : public IArrivalProcess
+{
+public:
+    PoissonArrivalProcess(double ratePerSec, uint64_t seed = std::random_device{}())
+        : ratePerSec_{ratePerSec},
+          rngEngine_{seed},
+          exponentialDistribution_{ratePerSec / 1e9} // Rate per nanosecond
+    {
+        if (ratePerSec <= 0.0)
+        {
+            throw std::invalid_argument("PoissonArrivalProcess: rate must be positive");
+        }
+    }
+
+    double nextInterArrivalNs() override
+    {
+        return exponentialDistribution_(rngEngine_);
+    }
+
+    double meanRate() const override { return ratePerSec_; }
+
+private:
+    double ratePerSec_;
+    std::mt19937_64 rngEngine_;
+    std::exponential_distribution<double> exponentialDistribution_;
+};
+
+/**
+ * @brief Self-exciting Hawkes process with an exponential kernel.
+ *
+ * Intensity:  lambda(t) = mu + sum_{t_i < t} alpha * exp(-beta * (t - t_i))
+ *
+ * Every event raises the intensity by alpha, which then decays at rate beta,
+ * so events cluster into microbursts. Stationary when alpha / beta < 1, with
+ * mean rate mu / (1 - alpha / beta).
+ *
+ * Simulated exactly with Ogata thinning: between events the intensity only
+ * decays, so its value right after the last event is a valid upper bound.
+ */
+class HawkesArrivalProcess : public IArrivalProcess
+{
+public:
+    /**
+     * @param baseRate  mu, background events / second
+     * @param alpha     Intensity jump per event (events / second)
+     * @param beta      Decay rate of the excitation (1 / second)
+     */
+    HawkesArrivalProcess(double baseRate, double alpha, double beta, uint64_t seed = std::random_device{}())
+        : baseRate_{baseRate / 1e9},
+          alpha_{alpha / 1e9},
+          beta_{beta / 1e9},
+          rngEngine_{seed},
+          uniformDistribution_{0.0, 1.0}
+    {
+        if (baseRate <= 0.0 || alpha < 0.0 || beta <= 0.0)
+        {
+            throw std::invalid_argument("HawkesArrivalProcess: rates must be positive");
+        }
+        if (alpha / beta >= 1.0)
+        {
+            throw std::invalid_argument("HawkesArrivalProcess: alpha / beta must be < 1 (explosive otherwise)");
+        }
+    }
+
+    double nextInterArrivalNs() override
+    {
+        double elapsed = 0.0;
+        while (true)
+        {
+            // 1. Upper bound: intensity right now (it only decays until the next event)
+            double excess = excess_ * std::exp(-beta_ * elapsed);
+            double lambdaBar = baseRate_ + excess;
+
+            // 2. Candidate from the dominating Poisson process
+            elapsed += -std::log(1.0 - uniformDistribution_(rngEngine_)) / lambdaBar;
+
+            // 3. Accept with probability lambda(candidate) / lambdaBar
+            double excessAtCandidate = excess_ * std::exp(-beta_ * elapsed);
+            if (uniformDistribution_(rngEngine_) * lambdaBar <= baseRate_ + excessAtCandidate)
+            {
+                // Event: decay the excitation up to now and add this event's kick
+                excess_ = excessAtCandidate + alpha_;
+                return elapsed;
+            }
+        }
+    }
+
+    double meanRate() const override
+    {
+        return baseRate_ * 1e9 / (1.0 - alpha_ / beta_);
+    }
+
+    // Current intensity right after the last event (events / second)
+    double currentIntensity() const { return (baseRate_ + excess_) * 1e9; }
+
+private:
+    // All rates stored per nanosecond
+    double baseRate_;
+    double alpha_;
+    double beta_;
+    double excess_ = 0.0; // Sum of decayed kicks at the last event
+
+    std::mt19937_64 rngEngine_;
+    std::uniform_real_distribution<double> uniformDistribution_;
+};
+
+/**
+ * @brief Builds an arrival process from a short spec string.
+ *
+ *   "poisson:<rate>"                -> PoissonArrivalProcess(rate)
+ *   "hawkes:<mu>:<alpha>:<beta>"    -> HawkesArrivalProcess(mu, alpha, beta)
+ *
+ * Rates are events / second. Throws std::invalid_argument on a bad spec.
+ */
+inline std::unique_ptr<IArrivalProcess> makeArrivalProcess(std::string_view spec, uint64_t seed = std::random_device{}())
+{
+    std::vector<std::string> parts;
+    std::size_t start = 0;
+    while (start <= spec.size())
+    {
+        std::size_t end = spec.find(':', start);
+        if (end == std::string_view::npos)
+            end = spec.size();
+        parts.emplace_back(spec.substr(start, end - start));
+        start = end + 1;
+    }
+
+    if (parts[0] == "poisson" && parts.size() == 2)
+    {
+        return std::make_unique<PoissonArrivalProcess>(std::stod(parts[1]), seed);
+    }
+    if (parts[0] == "hawkes" && parts.size() == 4)
+    {
+        return std::make_unique<HawkesArrivalProcess>(std::stod(parts[1]), std::stod(parts[2]), std::stod(parts[3]), seed);
+    }
+    throw std::invalid_argument("Unknown arrival spec '" + std::string(spec) + "' (expected poisson:<rate> or hawkes:<mu>:<alpha>:<beta>)");
+}
+
+#endif // MARKET_DATA_SYSTEM_ARRIVAL_PROCESS_H
@@ -0,0 +1,26 @@
+#ifndef MARKET_DATA_SYSTEM_ENCODED_MESSAGE_H
+#define MARKET_DATA_SYSTEM_ENCODED_MESSAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Stamps ahead of one encoded datagram in the encoder -> sender ring.
+ *
+ * Three-stage pipeline record in a ByteRingBuffer: this header, then the
+ * wire bytes (only as many as the message has). The tick's producer-side
+ * stamps ride along so the sender can record every latency stage.
+ */
+struct EncodedMessageHeader
+{
+    uint64_t generated_tsc; // Copied from the MarketTick
+    uint64_t enqueue_tsc;   // Copied from the MarketTick
+    uint64_t dequeue_tsc;   // Encoder popped the tick
+    uint64_t encoded_tsc;   // Encoder finished the wire bytes
+};
+
+static_assert(std::is_trivially_copyable_v<EncodedMessageHeader>);
+static_assert(sizeof(EncodedMessageHeader) == 32);
+
+#endif // MARKET_DATA_SYSTEM_ENCODED_MESSAGE_H
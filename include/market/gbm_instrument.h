@@ -0,0 +1,79 @@
+#ifndef MARKET_DATA_SYSTEM_GBM_INSTRUMENT_H
+#define MARKET_DATA_SYSTEM_GBM_INSTRUMENT_H
+
+#include <cmath>
+#include <cstdint>
+
+#include <core/xoshiro256.h>
+#include <market/tick_tape.h>
+
+/**
+ * @brief Self-contained state of one simulated instrument: GBM price,
+ * Poisson arrival clock and a private xoshiro256++ stream.
+ *
+ * Everything an instrument draws comes from its own stream, so its tick
+ * sequence is the same whichever thread or scheduler drives it.
+ */
+struct GbmInstrument
+{
+    Xoshiro256PlusPlus rng;
+    double price;
+    double clockNs; // Time of the next tick
+    double drift;
+    double diffusion;
+    double meanGapNs;
+    uint32_t id;
+
+    GbmInstrument(const Xoshiro256PlusPlus &stream, uint32_t instrumentId, double startPrice,
+                  double mu, double sigma, double dt, double ratePerSec)
+        : rng{stream},
+          price{startPrice},
+          clockNs{0.0},
+          drift{(mu - 0.5 * sigma * sigma) * dt},
+          diffusion{sigma * std::sqrt(dt)},
+          meanGapNs{1e9 / ratePerSec},
+          id{instrumentId}
+    {
+        clockNs = nextGapNs();
+    }
+
+    // Uniform in (0, 1] from the top 53 bits
+    double uniform() { return (static_cast<double>(rng() >> 11) + 1.0) * 0x1.0p-53; }
+
+    double nextGapNs() { return -std::log(uniform()) * meanGapNs; }
+
+    double nextNormal()
+    {
+        // Box-Muller, second variate discarded so there is no cached state to carry
+        const double u1 = uniform();
+        const double u2 = uniform();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+
+    /**
+     * @brief Steps the price, quotes around it and advances the arrival clock.
+     */
+    TapeRecord nextTick(uint64_t timestampNs)
+    {
+        // 1. GBM step
+        price *= std::exp(drift + diffusion * nextNormal());
+
+        // 2. Quote around the mid
+        const uint64_t noise = rng();
+        const double spread = std::round((0.05 + static_cast<double>(noise & 0xFFFF) / 65536.0 * 0.01) * 100.0) / 100.0;
+
+        TapeRecord record{};
+        record.timestampNs = timestampNs;
+        record.symbolId = id;
+        record.bid = price - spread / 2.0;
+        record.ask = price + spread / 2.0;
+        record.bidSize = 50 + static_cast<int32_t>((noise >> 16) % 100);
+        record.askSize = record.bidSize;
+
+        // 3. Next arrival
+        clockNs += nextGapNs();
+        return record;
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_GBM_INSTRUMENT_H
@@ -0,0 +1,95 @@
+#ifndef MARKET_DATA_SYSTEM_HESTON_GENERATOR_H
+#define MARKET_DATA_SYSTEM_HESTON_GENERATOR_H
+
+#include <market/price_generator.h>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * @brief Heston model parameters (shared by every instrument in a batch)
+ *
+ * dS = mu*S dt + sqrt(v)*S dW1
+ * dv = kappa*(theta - v) dt + xi*sqrt(v) dW2,   corr(dW1, dW2) = rho
+ */
+struct HestonParameters
+{
+    double mu = 0.05;    // Drift
+    double kappa = 2.0;  // Mean-reversion speed of variance
+    double theta = 0.04; // Long-run variance (0.04 -> 20% vol)
+    double xi = 0.5;     // Vol-of-vol
+    double rho = -0.7;   // Price / variance correlation (leverage effect)
+    double v0 = 0.04;    // Initial variance
+};
+
+/**
+ * @brief Batched Heston stochastic-volatility generator.
+ *
+ * Full-truncation Euler scheme in log-price so the price stays positive and
+ * the variance is floored at zero only where it is used:
+ *
+ *   v+        = max(v, 0)
+ *   ln S     += (mu - 0.5*v+) dt + sqrt(v+ dt) * Z1
+ *   v        += kappa*(theta - v+) dt + xi*sqrt(v+ dt) * (rho*Z1 + sqrt(1-rho^2)*Z2)
+ *
+ * Price and variance are SoA arrays, one step advances every instrument.
+ * Volatility clusters per instrument, giving bursty quote changes downstream.
+ */
+template <Arithmetic PriceType>
+class HestonGenerator : public IBatchPriceGenerator<PriceType>
+{
+public:
+    HestonGenerator(std::size_t instruments, PriceType startPrice, const HestonParameters &params,
+                    double dt_s, uint64_t seed = std::random_device{}())
+        : params_{params},
+          dt_{dt_s},
+          sqrtDt_{std::sqrt(dt_s)},
+          rhoBar_{std::sqrt(1.0 - params.rho * params.rho)},
+          prices_(instruments, startPrice > 0 ? startPrice : PriceType{1}),
+          variance_(instruments, params.v0),
+          rngEngine_{seed},
+          normalDistribution_{0.0, 1.0}
+    {
+    }
+
+    void step() override
+    {
+        const std::size_t n = prices_.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // 1. Two independent shocks, correlate the variance shock with the price shock
+            double z1 = normalDistribution_(rngEngine_);
+            double z2 = params_.rho * z1 + rhoBar_ * normalDistribution_(rngEngine_);
+
+            // 2. Full truncation: negative variance contributes nothing
+            double vPos = std::max(variance_[i], 0.0);
+            double volDt = std::sqrt(vPos) * sqrtDt_;
+
+            // 3. Log-price and variance updates
+            prices_[i] *= std::exp((params_.mu - 0.5 * vPos) * dt_ + volDt * z1);
+            variance_[i] += params_.kappa * (params_.theta - vPos) * dt_ + params_.xi * volDt * z2;
+        }
+    }
+
+    std::span<const PriceType> prices() const override { return {prices_.data(), prices_.size()}; }
+    std::size_t size() const override { return prices_.size(); }
+
+    // Current (possibly negative, un-truncated) variance per instrument
+    std::span<const double> variances() const { return {variance_.data(), variance_.size()}; }
+
+private:
+    HestonParameters params_;
+    double dt_;
+    double sqrtDt_;
+    double rhoBar_; // sqrt(1 - rho^2)
+
+    std::vector<PriceType> prices_;
+    std::vector<double> variance_;
+
+    std::mt19937_64 rngEngine_;
+    std::normal_distribution<double> normalDistribution_;
+};
+
+#endif // MARKET_DATA_SYSTEM_HESTON_GENERATOR_H
@@ -0,0 +1,128 @@
+#ifndef MARKET_DATA_SYSTEM_INSTRUMENT_SCHEDULER_H
+#define MARKET_DATA_SYSTEM_INSTRUMENT_SCHEDULER_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <core/coroutine_scheduler.h>
+#include <core/tsc_clock.h>
+#include <core/xoshiro256.h>
+#include <market/gbm_instrument.h>
+#include <market/tick_tape.h>
+
+// Per-instrument tick rate and trading session (ns from scheduler start)
+struct InstrumentSpec
+{
+    double ratePerSec = 100.0;
+    uint64_t sessionOpenNs = 0;
+    uint64_t sessionCloseNs = std::numeric_limits<uint64_t>::max();
+    double startPrice = 100.0;
+    double mu = 0.1;
+    double sigma = 0.3;
+    double dt = 0.001;
+};
+
+/**
+ * @brief Drives tens of thousands of instruments from one thread.
+ *
+ * Each instrument is a coroutine: wait for its session to open, then loop
+ * { co_await next Poisson arrival; push a tick into the ring } until the
+ * session closes. The CoroutineScheduler's timer wheel resumes whichever
+ * instruments are due, so the cost per emission does not grow with the
+ * number of instruments (unlike one thread or one heap entry per instrument).
+ *
+ * Ring is anything with `bool push(const TapeRecord &)`, normally the
+ * LockFreeRingBuffer a consumer thread drains. A full ring is spun on, which
+ * stalls every instrument: back-pressure, not drops.
+ *
+ * Wake-ups are quantised to the scheduler resolution: ticks are stamped with
+ * their exact arrival time, but two instruments due within the same
+ * resolution step come out in scheduling order, not timestamp order.
+ */
+template <typename Ring>
+class InstrumentScheduler
+{
+public:
+    InstrumentScheduler(Ring &ring, const std::vector<InstrumentSpec> &specs,
+                        SchedulerClock clock = SchedulerClock::RealTime,
+                        uint64_t seed = 42, uint64_t resolutionNs = 1000)
+        : ring_{ring},
+          scheduler_{clock, resolutionNs}
+    {
+        if (specs.empty())
+        {
+            throw std::invalid_argument("InstrumentScheduler: no instruments");
+        }
+
+        // 1. One coroutine per instrument, each with its own RNG stream. The
+        //    instrument state lives in the coroutine frame next to its timer
+        //    node, so a resume touches one allocation.
+        Xoshiro256PlusPlus stream{seed};
+        for (std::size_t i = 0; i < specs.size(); ++i)
+        {
+            const InstrumentSpec &spec = specs[i];
+            if (spec.ratePerSec <= 0.0 || spec.sessionCloseNs <= spec.sessionOpenNs)
+            {
+                throw std::invalid_argument("InstrumentScheduler: bad rate / session for instrument " + std::to_string(i));
+            }
+
+            // 2. Nothing before the session opens: first arrival counts from the open
+            GbmInstrument instrument{stream, static_cast<uint32_t>(i), spec.startPrice, spec.mu, spec.sigma, spec.dt, spec.ratePerSec};
+            instrument.clockNs += static_cast<double>(spec.sessionOpenNs);
+            stream.jump();
+
+            scheduler_.spawn(instrumentTask(instrument, spec.sessionCloseNs));
+        }
+        instrumentCount_ = specs.size();
+    }
+
+    /**
+     * @brief Runs the scheduler on the calling thread (see CoroutineScheduler::run).
+     * @return Number of ticks pushed
+     */
+    uint64_t run(const std::atomic<bool> &running, uint64_t untilNs = TimerWheel::NO_TIMER, int cpu = -1)
+    {
+        running_ = &running;
+        uint64_t before = emitted_;
+        scheduler_.run(running, untilNs, cpu);
+        return emitted_ - before;
+    }
+
+    uint64_t emitted() const { return emitted_; }
+    uint64_t ringFullSpins() const { return ringFullSpins_; }
+    std::size_t instrumentCount() const { return instrumentCount_; }
+
+private:
+    Ring &ring_;
+    CoroutineScheduler scheduler_;
+    std::size_t instrumentCount_ = 0;
+    const std::atomic<bool> *running_ = nullptr;
+    uint64_t emitted_ = 0;
+    uint64_t ringFullSpins_ = 0;
+
+    ScheduledTask instrumentTask(GbmInstrument instrument, uint64_t sessionCloseNs)
+    {
+        // Poisson arrivals until the close
+        while (instrument.clockNs < static_cast<double>(sessionCloseNs))
+        {
+            const uint64_t timestampNs = static_cast<uint64_t>(instrument.clockNs);
+            co_await scheduler_.sleepUntil(timestampNs);
+
+            const TapeRecord record = instrument.nextTick(timestampNs);
+            while (!ring_.push(record))
+            {
+                ++ringFullSpins_;
+                if (running_ && !running_->load(std::memory_order_relaxed))
+                    co_return;
+                cpuRelax();
+            }
+            ++emitted_;
+        }
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_INSTRUMENT_SCHEDULER_H
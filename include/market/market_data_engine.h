@@ -0,0 +1,732 @@
+#ifndef MARKET_DATA_SYSTEM_MARKET_DATA_ENGINE_H
+#define MARKET_DATA_SYSTEM_MARKET_DATA_ENGINE_H
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <format>
+#include <mutex>
+#include <condition_variable>
+#include <span>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <charconv>
+#include <algorithm>
+
+// --- Project Components ---
+#include <market/market_tick.h>
+#include <market/symbol_registry.h>
+#include <market/tick_sources.h>
+#include <market/arrival_process.h>
+#include <market/tape_replayer.h>
+#include <market/stage_latency.h>
+#include <market/encoded_message.h>
+#include <core/tsc_pacer.h>
+#include <core/rate_controller.h>
+#include <core/wait_strategy.h>
+#include <core/byte_ring_buffer.h>
+#include <core/thread_placement.h>
+#include <core/metrics_registry.h>
+#include <core/async_logger.h>
+#include <fix/snapshot_encoder.h>
+#include <network/transports.h>
+
+using price = double;
+
+/**
+ * @brief Thread layout behind an engine's queue.
+ *
+ * TwoStage:   consumer pops, encodes and sends (one core does both).
+ * ThreeStage: an encoder thread pops and encodes straight into a byte
+ *             ring of encoded messages (ByteRingBuffer), the consumer only
+ *             hands them from the ring to the transport, so encode and send
+ *             overlap on two cores at the cost of one more hand-off (the
+ *             Handoff latency stage).
+ */
+enum class PipelineMode
+{
+    TwoStage,
+    ThreeStage,
+};
+
+// Consumes "--stages 2|3" from argv (in place, as ThreadPlacement::fromArgs does)
+inline PipelineMode pipelineModeFromArgs(int &argc, char **argv)
+{
+    PipelineMode mode = PipelineMode::TwoStage;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--stages" && i + 1 < argc)
+        {
+            std::string_view stages = argv[++i];
+            if (stages != "2" && stages != "3")
+                throw std::invalid_argument("--stages must be 2 or 3");
+            mode = stages == "3" ? PipelineMode::ThreeStage : PipelineMode::TwoStage;
+        }
+        else
+        {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+    return mode;
+}
+
+// Most datagrams one send hands the transport (one sendmmsg on UDP)
+inline constexpr std::size_t MAX_SEND_BATCH = UDPMulticastSender::MAX_BATCH;
+
+// Consumes "--batch N" (1..MAX_SEND_BATCH) from argv in place, 1 = one send per tick
+inline std::size_t sendBatchFromArgs(int &argc, char **argv)
+{
+    std::size_t batch = 1;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--batch" && i + 1 < argc)
+        {
+            std::string_view value = argv[++i];
+            auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), batch);
+            if (ec != std::errc{} || end != value.data() + value.size() || batch < 1 || batch > MAX_SEND_BATCH)
+                throw std::invalid_argument(std::format("--batch must be 1..{}", MAX_SEND_BATCH));
+        }
+        else
+        {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+    return batch;
+}
+
+// One monitor interval of an engine (or several): counts, drops / retries, then per-stage latency
+inline void logPipelineMetrics(const MetricsCollector &metrics)
+{
+    logInfo("[Metrics] Ticks / secs: Generated = {}, Sent = {}, QueueFull = {}, SendRetries = {}, ENOBUFS = {}, EAGAIN = {}, "
+            "Dropped = {}, SendErrors = {}, {:.2f} MB/s",
+            metrics.delta("ticks_generated"), metrics.delta("ticks_sent"), metrics.delta("queue_full"),
+            metrics.delta("send_retries"), metrics.delta("send_enobufs"), metrics.delta("send_eagain"),
+            metrics.delta("send_dropped"), metrics.delta("send_errors"), metrics.delta("bytes_sent") / 1e6);
+    // A/B lines (UdpTransport --line-b, impaired line A), only those that exist
+    for (std::string_view line : {"line_a", "line_b"})
+    {
+        auto delta = [&](std::string_view counter) { return metrics.delta(std::format("{}_{}", line, counter)); };
+        const uint64_t sent = delta("sent");
+        const uint64_t lost = delta("lost");
+        const uint64_t overrun = delta("overrun");
+        const uint64_t errors = delta("errors");
+        if (sent + lost + overrun + errors > 0)
+            logInfo("[Lines] {}: Sent = {}, ImpairedLoss = {}, Overrun = {}, Errors = {}", line, sent, lost, overrun,
+                    errors);
+    }
+    logStageLatency(metrics);
+}
+
+/**
+ * @brief Busy share of every pipeline thread over one monitor interval.
+ *
+ * Busy = building / encoding / sending a tick; pacing and idling on an
+ * empty or full ring are not. A stage near 100% caps the feed: split it
+ * (ThreeStage) or shard. Averaged over `pipelines` engines of a collector.
+ */
+inline void logStageUtilization(const MetricsCollector &metrics, uint64_t intervalTsc, PipelineMode mode,
+                                std::size_t pipelines = 1)
+{
+    const double wall = static_cast<double>(intervalTsc) * static_cast<double>(pipelines);
+    auto busy = [&](std::string_view counter)
+    { return wall > 0 ? 100.0 * static_cast<double>(metrics.delta(counter)) / wall : 0.0; };
+
+    if (mode == PipelineMode::ThreeStage)
+    {
+        logInfo("[Stages] Busy: producer {:.1f}%, encoder {:.1f}%, sender {:.1f}% | EncodedFull = {}, Oversize = {}",
+                busy("busy_tsc.producer"), busy("busy_tsc.encoder"), busy("busy_tsc.consumer"),
+                metrics.delta("encoded_full"), metrics.delta("encode_oversize"));
+    }
+    else
+    {
+        logInfo("[Stages] Busy: producer {:.1f}%, consumer {:.1f}%", busy("busy_tsc.producer"), busy("busy_tsc.consumer"));
+    }
+}
+
+/**
+ * @brief Producer -> queue -> encoder -> transport pipeline, policies fixed at compile time.
+ *
+ * @tparam Generator     TickSource (tick_sources.h), held by value
+ * @tparam Queue         SPSC queue of MarketTick: LockFreeRingBuffer (push/pop may fail)
+ *                       or BlockingRingBuffer (push/pop park the thread, has stop())
+ * @tparam WaitStrategy  Static idle() called while a non-blocking queue is full / empty
+ * @tparam Encoder       encode(const MarketTick &) -> span of wire bytes
+ * @tparam Transport     send(span, running) -> bool, optionally sendBatch(spans, running) -> count
+ *
+ * Every policy is a concrete member, so the whole hot path (price model,
+ * push, pop, encode, send) is visible to the compiler and inlines; there
+ * is no virtual call between generation and the socket.
+ *
+ * Threads: producer (generator or tape -> queue), consumer (queue -> encoder
+ * -> transport) and a 1 Hz monitor. Encoder-target replay drops the producer
+ * and has the consumer read the tape directly. In PipelineMode::ThreeStage
+ * an encoder thread takes over queue -> encoder -> encoded ring and the
+ * consumer (the sender) only sends.
+ *
+ * setSendBatch(N): the sending thread takes whatever is already queued (or
+ * encoded), up to N, and hands it to the transport in one sendBatch() call,
+ * one system call instead of N. It never waits to fill a batch, so a quiet
+ * feed still goes out one tick at a time.
+ *
+ * Every thread counts into its own ThreadMetrics (single writer, no shared
+ * lines); the monitor reads them through a MetricsCollector and prints
+ * per-interval counts, drops / retries, per-stage latency percentiles
+ * (stage_latency.h) and per-thread utilization.
+ */
+template <TickSource Generator, typename Queue, typename WaitStrategy, typename Encoder, typename Transport>
+class MarketDataEngine
+{
+public:
+    /**
+     * @param transport      Destination for the Transport policy
+     * @param generatorArgs  Forwarded to Generator after the engine's SymbolRegistry
+     */
+    template <typename... GeneratorArgs>
+    explicit MarketDataEngine(const TransportConfig &transport = {}, GeneratorArgs &&...generatorArgs)
+        : generator_{symbols_, std::forward<GeneratorArgs>(generatorArgs)...},
+          encoder_{symbols_},
+          transport_{transport},
+          producerMetrics_{metrics_.registerThread("producer")},
+          consumerMetrics_{metrics_.registerThread("consumer")},
+          encoderMetrics_{metrics_.registerThread("encoder")},
+          latency_{metrics_, consumerMetrics_}
+    {
+        // Transports with their own counters (retries, ENOBUFS, drops) write them on the consumer
+        if constexpr (requires { transport_.bindMetrics(metrics_, consumerMetrics_); })
+        {
+            transport_.bindMetrics(metrics_, consumerMetrics_);
+        }
+        logInfo("MarketDataEngine<{}, {}, {}, {}> initialised. Dest={}:{}", Generator::name(), WaitStrategy::name(),
+                Encoder::name(), Transport::name(), transport.destIp, transport.port);
+    }
+
+    void start()
+    {
+        const bool threeStage = mode_ == PipelineMode::ThreeStage;
+        // Throws before any thread exists if the placement cannot be honoured
+        checkThreadPlacement(placement_, threeStage);
+        if (rateController_)
+            rateController_->start();
+        if (threeStage && !encoded_)
+            encoded_ = std::make_unique<EncodedRing>();
+        batchHeaders_.resize(sendBatch_);
+        batchWire_.resize(sendBatch_);
+        if (!threeStage && sendBatch_ > 1)
+            batchBytes_.resize(sendBatch_ * MAX_ENCODED_SIZE);
+        // Encoder-target replay reads the tape on the consumer, no producer needed
+        if (!(replayer_ && replayTarget_ == ReplayTarget::Encoder))
+        {
+            threads_.emplace_back([this]
+                                  {
+                applyThreadPlacement(threadTag_ + "-producer", placement_.producer);
+                producerThread(); });
+        }
+        if (threeStage)
+        {
+            threads_.emplace_back([this]
+                                  {
+                applyThreadPlacement(threadTag_ + "-encoder", placement_.encoder);
+                consumerThread(); });
+            threads_.emplace_back([this]
+                                  {
+                applyThreadPlacement(threadTag_ + "-sender", placement_.consumer);
+                senderThread(); });
+        }
+        else
+        {
+            threads_.emplace_back([this]
+                                  {
+                applyThreadPlacement(threadTag_ + "-consumer", placement_.consumer);
+                consumerThread(); });
+        }
+        if (monitorEnabled_)
+        {
+            threads_.emplace_back([this]
+                                  {
+                applyThreadPlacement(threadTag_ + "-monitor", placement_.monitor);
+                monitorThread(); });
+        }
+    }
+
+    void stop()
+    {
+        running_.store(false, std::memory_order_relaxed);
+        CVMonitor_.notify_all();
+        // A blocking queue parks its threads, wake them so they see running_
+        if constexpr (requires(Queue &q) { q.stop(); })
+        {
+            queue_.stop();
+        }
+    }
+
+    // Stop and join all threads
+    void join()
+    {
+        stop();
+        threads_.clear();
+    }
+
+    ~MarketDataEngine()
+    {
+        if (running_.load())
+            stop();
+    }
+
+    MarketDataEngine(const MarketDataEngine &) = delete;
+    MarketDataEngine &operator=(const MarketDataEngine &) = delete;
+
+    auto &getQueue() { return queue_; }
+    const SymbolRegistry &symbols() const { return symbols_; }
+    // Totals since start() (sums of the per-thread counters)
+    uint64_t getGeneratedCount() const { return metrics_.total(TICKS_GENERATED); }
+    uint64_t getSentCount() const { return metrics_.total(TICKS_SENT); }
+    // Every thread's counters and histograms, for a MetricsCollector
+    const MetricsRegistry &metrics() const { return metrics_; }
+
+    // Tick pacing: inter-arrival times from the process, released by a TSC pacer.
+    // Call before start(). nullptr = unpaced (push as fast as the queue allows).
+    void setArrivalProcess(std::unique_ptr<IArrivalProcess> arrivals) { arrivals_ = std::move(arrivals); }
+
+    /**
+     * @brief Drive the producer at a target rate profile (see makeRateProfile).
+     *
+     * Takes precedence over an arrival process. The monitor reports target vs
+     * achieved rate and schedule lag every second. Call before start().
+     */
+    void setRateProfile(RateProfile profile) { rateController_ = std::make_unique<RateController>(std::move(profile)); }
+
+    // Rate profile spec (constant/step/ramp/burst) or arrival spec (poisson/hawkes)
+    void setPacing(std::string_view spec)
+    {
+        if (isRateProfileSpec(spec))
+            setRateProfile(makeRateProfile(spec));
+        else
+            setArrivalProcess(makeArrivalProcess(spec));
+    }
+
+    // Call before start(). false = no monitor thread / [Metrics] output.
+    void setMonitorEnabled(bool enabled) { monitorEnabled_ = enabled; }
+
+    // Two or three threads behind the queue (see PipelineMode). Call before start().
+    void setPipelineMode(PipelineMode mode) { mode_ = mode; }
+    PipelineMode pipelineMode() const { return mode_; }
+
+    // Datagrams per transport call, 1..MAX_SEND_BATCH (clamped). Call before start().
+    void setSendBatch(std::size_t batch) { sendBatch_ = std::clamp<std::size_t>(batch, 1, MAX_SEND_BATCH); }
+    std::size_t sendBatch() const { return sendBatch_; }
+
+    // CPU set / SCHED_FIFO / name per thread role, checked and applied by start()
+    void setThreadPlacement(ThreadPlacement placement) { placement_ = std::move(placement); }
+    // Thread name prefix ("md" -> md-producer, md-consumer, md-monitor), at most 6 characters fit
+    void setThreadTag(std::string tag) { threadTag_ = std::move(tag); }
+
+    /**
+     * @brief Replay a pre-built tape (see tape_builder) instead of generating prices.
+     *
+     * Ring:    producer thread streams records into the queue.
+     * Encoder: consumer thread streams records straight into the encoder.
+     * Call before start().
+     */
+    void enableReplay(const std::string &tapePath, ReplayTiming timing, ReplayTarget target = ReplayTarget::Ring)
+    {
+        replayer_ = std::make_unique<TapeReplayer>(tapePath, timing);
+        replayTarget_ = target;
+
+        // Tape symbol table -> registry IDs, resolved once so replay never touches names
+        const TapeReader &tape = replayer_->tape();
+        tapeSymbolIds_.clear();
+        for (uint32_t i = 0; i < tape.symbolCount(); ++i)
+        {
+            tapeSymbolIds_.push_back(symbols_.intern(tape.symbol(i)));
+        }
+        logInfo("Replay enabled: {} ({} records)", tapePath, tape.header().recordCount);
+    }
+
+private:
+    // Declaration order matters: the registry is filled by the generator's constructor
+    SymbolRegistry symbols_;
+    Generator generator_;
+    Encoder encoder_;
+    Transport transport_;
+    Queue queue_;
+
+    std::unique_ptr<IArrivalProcess> arrivals_;
+    std::unique_ptr<RateController> rateController_;
+    std::unique_ptr<TapeReplayer> replayer_;
+    ReplayTarget replayTarget_ = ReplayTarget::Ring;
+    std::vector<uint32_t> tapeSymbolIds_; // Tape symbol index -> SymbolRegistry ID
+    bool monitorEnabled_ = true;
+    PipelineMode mode_ = PipelineMode::TwoStage;
+    std::size_t sendBatch_ = 1;
+    ThreadPlacement placement_;
+    std::string threadTag_ = "md";
+
+    // Registered in this order in every engine, so the IDs are constants
+    static constexpr std::size_t TICKS_GENERATED = 0;
+    static constexpr std::size_t TICKS_SENT = 1;
+    static constexpr std::size_t QUEUE_FULL = 2;
+    static constexpr std::size_t BYTES_SENT = 3;
+    static constexpr std::size_t BUSY_PRODUCER = 4; // TSC ticks spent on work, per thread role
+    static constexpr std::size_t BUSY_ENCODER = 5;
+    static constexpr std::size_t BUSY_CONSUMER = 6;
+    static constexpr std::size_t ENCODED_FULL = 7;
+    static constexpr std::size_t ENCODE_OVERSIZE = 8;
+    static constexpr std::size_t SCHEDULE_LAG_NS = 0; // Gauge
+
+    // Encoder -> sender hand-off of a three-stage pipeline: header + wire bytes per
+    // record, variable length (256 KB, allocated by start())
+    using EncodedRing = ByteRingBuffer<256 * 1024>;
+    static constexpr std::size_t MAX_ENCODED_SIZE = 1024; // Reserved per message, committed to its size
+    std::unique_ptr<EncodedRing> encoded_;
+
+    // Staged send batch (sized by start()): stamps and wire bytes per message.
+    // Two-stage batches encode into batchBytes_, three-stage ones point into the ring.
+    std::vector<EncodedMessageHeader> batchHeaders_;
+    std::vector<std::span<const uint8_t>> batchWire_;
+    std::vector<uint8_t> batchBytes_;
+
+    MetricsRegistry metrics_ = makeRegistry();
+    ThreadMetrics &producerMetrics_;
+    ThreadMetrics &consumerMetrics_; // The thread that sends, in either mode
+    ThreadMetrics &encoderMetrics_;  // Three-stage only
+    StageLatency latency_;           // Histograms in consumerMetrics_
+    std::atomic<bool> running_{true};
+    std::condition_variable CVMonitor_;
+    std::mutex CVMutex_;
+    // Last member: destroyed (joined) before anything the threads touch
+    std::vector<std::jthread> threads_;
+
+    static MetricsRegistry makeRegistry()
+    {
+        MetricsRegistry registry;
+        registry.counter("ticks_generated");
+        registry.counter("ticks_sent");
+        registry.counter("queue_full");
+        registry.counter("bytes_sent");
+        registry.counter("busy_tsc.producer");
+        registry.counter("busy_tsc.encoder");
+        registry.counter("busy_tsc.consumer");
+        registry.counter("encoded_full");
+        registry.counter("encode_oversize");
+        registry.gauge("schedule_lag_ns");
+        return registry;
+    }
+
+    // Stamp and push, idling while a non-blocking queue is full. false = stopped first.
+    bool enqueue(MarketTick &tick, ThreadMetrics &metrics)
+    {
+        tick.enqueue_tsc = readTsc();
+        if (queue_.push(tick))
+            return true;
+
+        // Counted once per tick that found the ring full, not per retry
+        metrics.add(QUEUE_FULL);
+        do
+        {
+            if (!running_.load(std::memory_order_relaxed))
+                return false;
+            WaitStrategy::idle();
+        } while (!queue_.push(tick));
+        return true;
+    }
+
+    void producerThread()
+    {
+        if (replayer_)
+        {
+            replayProducer();
+            return;
+        }
+
+        MarketTick tick{};
+        TscPacer pacer;
+        const uint64_t startTsc = readTsc();
+
+        while (running_.load(std::memory_order_relaxed))
+        {
+            // Pace only if a rate profile or an arrival process was configured
+            if (rateController_)
+                producerMetrics_.set(SCHEDULE_LAG_NS, static_cast<int64_t>(rateController_->acquire()));
+            else if (arrivals_)
+                pacer.wait(arrivals_->nextInterArrivalNs());
+
+            const uint64_t buildTsc = readTsc();
+            generator_.next(tick);
+            tick.sequence++;
+            tick.generated_tsc = readTsc();
+            tick.timestamp_ns = static_cast<uint64_t>(TscClock::toNs(tick.generated_tsc - startTsc));
+
+            if (!enqueue(tick, producerMetrics_))
+                return;
+            producerMetrics_.add(TICKS_GENERATED);
+            producerMetrics_.add(BUSY_PRODUCER, tick.enqueue_tsc - buildTsc);
+        }
+    }
+
+    // Two-stage: queue -> encoder -> transport. Three-stage (the encoder thread): queue -> encoder -> encoded ring.
+    void consumerThread()
+    {
+        const bool handOff = mode_ == PipelineMode::ThreeStage;
+        ThreadMetrics &metrics = handOff ? encoderMetrics_ : consumerMetrics_;
+        MarketTick tick{};
+
+        if (replayer_ && replayTarget_ == ReplayTarget::Encoder)
+        {
+            replayer_->replay([&](const TapeRecord &record)
+                              {
+                fillFromRecord(tick, record);
+                tick.enqueue_tsc = tick.generated_tsc; // No queue on this path
+                metrics.add(TICKS_GENERATED);
+                if (handOff)
+                    return encodeToRing(tick, readTsc());
+                publish(tick, readTsc());
+                return true; }, running_);
+            return;
+        }
+
+        while (running_.load(std::memory_order_relaxed))
+        {
+            if (!queue_.pop(tick))
+            {
+                WaitStrategy::idle();
+                continue;
+            }
+            const uint64_t dequeueTsc = readTsc();
+            // A stopped blocking queue returns without data
+            if (!running_.load(std::memory_order_relaxed))
+                break;
+            if (!handOff && sendBatch_ > 1)
+                publishBatch(tick, dequeueTsc);
+            else if (!handOff)
+                publish(tick, dequeueTsc);
+            else if (!encodeToRing(tick, dequeueTsc))
+                break;
+        }
+    }
+
+    void publish(const MarketTick &tick, uint64_t dequeueTsc)
+    {
+        auto wire = encoder_.encode(tick);
+        const uint64_t encodedTsc = readTsc();
+        const bool sent = transport_.send(wire, running_);
+        const uint64_t sentTsc = readTsc();
+        consumerMetrics_.add(BUSY_CONSUMER, sentTsc - dequeueTsc);
+        if (sent)
+        {
+            latency_.record(tick, dequeueTsc, encodedTsc, sentTsc);
+            consumerMetrics_.add(TICKS_SENT);
+            consumerMetrics_.add(BYTES_SENT, wire.size());
+        }
+    }
+
+    // Two-stage with a send batch: this tick plus whatever is already queued, encoded side by side, one send
+    void publishBatch(MarketTick &tick, uint64_t dequeueTsc)
+    {
+        const uint64_t startTsc = dequeueTsc;
+        std::size_t count = 0;
+        for (std::size_t popped = 1;; ++popped)
+        {
+            std::span<uint8_t> slot(batchBytes_.data() + count * MAX_ENCODED_SIZE, MAX_ENCODED_SIZE);
+            const std::size_t size = encodeTo(tick, slot);
+            if (size == 0)
+            {
+                consumerMetrics_.add(ENCODE_OVERSIZE);
+            }
+            else
+            {
+                batchHeaders_[count] = {tick.generated_tsc, tick.enqueue_tsc, dequeueTsc, readTsc()};
+                batchWire_[count++] = slot.first(size);
+            }
+            if (popped == sendBatch_ || !popQueued(tick))
+                break;
+            dequeueTsc = readTsc();
+        }
+
+        const std::size_t sent = sendStaged(count);
+        const uint64_t sentTsc = readTsc();
+        consumerMetrics_.add(BUSY_CONSUMER, sentTsc - startTsc);
+        uint64_t bytes = 0;
+        for (std::size_t i = 0; i < sent; ++i)
+        {
+            latency_.record(batchHeaders_[i], sentTsc);
+            bytes += batchWire_[i].size();
+        }
+        consumerMetrics_.add(TICKS_SENT, sent);
+        consumerMetrics_.add(BYTES_SENT, bytes);
+    }
+
+    // Pop without waiting: a blocking queue would park on empty, so only pop what is already there
+    bool popQueued(MarketTick &tick)
+    {
+        if constexpr (requires(Queue &q) { q.stop(); })
+        {
+            if (queue_.size() == 0)
+                return false;
+        }
+        return queue_.pop(tick);
+    }
+
+    // Hand batchWire_[0, count) to the transport: send() for one, sendBatch() for more. Returns the count sent.
+    std::size_t sendStaged(std::size_t count)
+    {
+        if constexpr (requires(std::span<const std::span<const uint8_t>> batch) { transport_.sendBatch(batch, running_); })
+        {
+            if (count > 1)
+                return transport_.sendBatch(std::span<const std::span<const uint8_t>>(batchWire_.data(), count), running_);
+        }
+        std::size_t sent = 0;
+        while (sent < count && transport_.send(batchWire_[sent], running_))
+            ++sent;
+        return sent;
+    }
+
+    // Encode into `out` in place (or encode + copy). Returns the size, 0 = does not fit.
+    std::size_t encodeTo(const MarketTick &tick, std::span<uint8_t> out)
+    {
+        if constexpr (requires { encoder_.encodeInto(tick, out); })
+        {
+            return encoder_.encodeInto(tick, out);
+        }
+        else
+        {
+            auto wire = encoder_.encode(tick);
+            if (wire.size() > out.size())
+                return 0;
+            std::memcpy(out.data(), wire.data(), wire.size());
+            return wire.size();
+        }
+    }
+
+    // Encoder thread: encode straight into the encoded ring. false = stopped while the ring was full.
+    bool encodeToRing(const MarketTick &tick, uint64_t dequeueTsc)
+    {
+        constexpr std::size_t HEADER_SIZE = sizeof(EncodedMessageHeader);
+        std::span<uint8_t> record = encoded_->reserve(HEADER_SIZE + MAX_ENCODED_SIZE);
+        uint64_t workTsc = dequeueTsc;
+        if (record.empty())
+        {
+            // Sender behind: counted once per message, as QUEUE_FULL is
+            encoderMetrics_.add(ENCODED_FULL);
+            do
+            {
+                if (!running_.load(std::memory_order_relaxed))
+                    return false;
+                WaitStrategy::idle();
+                record = encoded_->reserve(HEADER_SIZE + MAX_ENCODED_SIZE);
+            } while (record.empty());
+            workTsc = readTsc();
+        }
+
+        const std::size_t size = encodeTo(tick, record.subspan(HEADER_SIZE));
+        const EncodedMessageHeader header{tick.generated_tsc, tick.enqueue_tsc, dequeueTsc, readTsc()};
+        encoderMetrics_.add(BUSY_ENCODER, header.encoded_tsc - workTsc);
+        if (size == 0)
+        {
+            // Uncommitted, the reservation is simply reused
+            encoderMetrics_.add(ENCODE_OVERSIZE);
+            return true;
+        }
+        std::memcpy(record.data(), &header, HEADER_SIZE);
+        encoded_->commit(HEADER_SIZE + size);
+        return true;
+    }
+
+    // Three-stage consumer: encoded ring -> transport, nothing else on this core
+    void senderThread()
+    {
+        while (running_.load(std::memory_order_relaxed))
+        {
+            std::span<const uint8_t> record = encoded_->read();
+            if (record.empty())
+            {
+                WaitStrategy::idle();
+                continue;
+            }
+            // Plus whatever else is already encoded, up to the batch; one release() frees them all
+            std::size_t count = 0;
+            do
+            {
+                std::memcpy(&batchHeaders_[count], record.data(), sizeof(EncodedMessageHeader));
+                // Wire bytes go to the socket from the ring, no copy
+                batchWire_[count++] = record.subspan(sizeof(EncodedMessageHeader));
+            } while (count < sendBatch_ && !(record = encoded_->read()).empty());
+
+            const uint64_t handoffTsc = readTsc();
+            const std::size_t sent = sendStaged(count);
+            const uint64_t sentTsc = readTsc();
+            encoded_->release();
+            consumerMetrics_.add(BUSY_CONSUMER, sentTsc - handoffTsc);
+            uint64_t bytes = 0;
+            for (std::size_t i = 0; i < sent; ++i)
+            {
+                latency_.record(batchHeaders_[i], handoffTsc, sentTsc);
+                bytes += batchWire_[i].size();
+            }
+            consumerMetrics_.add(TICKS_SENT, sent);
+            consumerMetrics_.add(BYTES_SENT, bytes);
+        }
+    }
+
+    void fillFromRecord(MarketTick &tick, const TapeRecord &record) const
+    {
+        tick.symbol_id = tapeSymbolIds_[record.symbolId];
+        tick.sequence++;
+        tick.timestamp_ns = record.timestampNs;
+        tick.generated_tsc = readTsc();
+        tick.bid = record.bid;
+        tick.ask = record.ask;
+        tick.bid_size = record.bidSize;
+        tick.ask_size = record.askSize;
+    }
+
+    void replayProducer()
+    {
+        MarketTick tick{};
+        uint64_t replayed = replayer_->replay([&](const TapeRecord &record)
+                                              {
+            fillFromRecord(tick, record);
+            if (!enqueue(tick, producerMetrics_))
+                return false;
+            producerMetrics_.add(TICKS_GENERATED);
+            producerMetrics_.add(BUSY_PRODUCER, tick.enqueue_tsc - tick.generated_tsc);
+            return true; }, running_);
+        logInfo("Producer thread stopped ({} records replayed).", replayed);
+    }
+
+    void monitorThread()
+    {
+        MetricsCollector collector({&metrics_});
+        uint64_t lastTsc = readTsc();
+        while (running_.load(std::memory_order_relaxed))
+        {
+            std::unique_lock<std::mutex> lock(CVMutex_);
+            bool stopping = CVMonitor_.wait_for(lock, std::chrono::seconds(1), [this]
+                                                { return !running_.load(std::memory_order_relaxed); });
+            if (stopping)
+                break;
+            collector.collect();
+            const uint64_t nowTsc = readTsc();
+            logPipelineMetrics(collector);
+            logStageUtilization(collector, nowTsc - lastTsc, mode_);
+            lastTsc = nowTsc;
+
+            if (rateController_)
+            {
+                RateSample rate = rateController_->sample();
+                logInfo("[Rate] Target = {}/s, Achieved = {}/s, Lag = {:.1f}us (max {:.1f}us)", static_cast<uint64_t>(rate.targetRate),
+                        static_cast<uint64_t>(rate.achievedRate), rate.lagNs / 1000.0, rate.maxLagNs / 1000.0);
+            }
+        }
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_MARKET_DATA_ENGINE_H
@@ -0,0 +1,36 @@
+#ifndef MARKET_DATA_SYSTEM_MARKET_TICK_H
+#define MARKET_DATA_SYSTEM_MARKET_TICK_H
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief One top-of-book update as it travels producer -> ring -> encoder.
+ *
+ * Plain data, exactly one cache line: a ring slot copy is a single 64-byte
+ * memcpy and two slots never share a line. The instrument is carried as a
+ * dense SymbolRegistry ID, the encoder turns it back into "55=" bytes.
+ * The two TSC stamps are the producer-side half of the per-stage latency
+ * breakdown (stage_latency.h); the consumer takes the rest locally.
+ */
+struct alignas(64) MarketTick
+{
+    uint32_t symbol_id; // SymbolRegistry ID
+    int32_t bid_size;
+    int32_t ask_size;
+    uint32_t flags;         // Reserved, zero
+    uint64_t sequence;      // Per-system, assigned by the producer
+    uint64_t timestamp_ns;  // Model / tape time of the tick
+    uint64_t generated_tsc; // readTsc() when the producer built the tick
+    double bid;
+    double ask;
+    uint64_t enqueue_tsc;   // readTsc() just before the push into the ring
+};
+
+static_assert(std::is_trivially_copyable_v<MarketTick>);
+static_assert(std::is_standard_layout_v<MarketTick>);
+static_assert(sizeof(MarketTick) == 64 && alignof(MarketTick) == 64);
+static_assert(offsetof(MarketTick, sequence) == 16 && offsetof(MarketTick, bid) == 40);
+
+#endif // MARKET_DATA_SYSTEM_MARKET_TICK_H
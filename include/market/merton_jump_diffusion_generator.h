@@ -0,0 +1,127 @@
+#ifndef MARKET_DATA_SYSTEM_MERTON_JUMP_DIFFUSION_GENERATOR_H
+#define MARKET_DATA_SYSTEM_MERTON_JUMP_DIFFUSION_GENERATOR_H
+
+#include <market/price_generator.h>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief Merton jump-diffusion parameters (shared by every instrument in a batch)
+ *
+ * GBM plus a compound Poisson process of log-normal jumps:
+ * jumps arrive with intensity lambda, each jump multiplies the price by exp(Y),
+ * Y ~ N(jumpMean, jumpStdDev^2).
+ */
+struct MertonParameters
+{
+    double mu = 0.05;         // Drift
+    double sigma = 0.2;       // Diffusive volatility
+    double lambda = 50.0;     // Jumps per year
+    double jumpMean = -0.005; // Mean log jump size
+    double jumpStdDev = 0.02; // Std dev of log jump size
+};
+
+/**
+ * @brief Batched Merton jump-diffusion generator.
+ *
+ *   ln S += (mu - 0.5*sigma^2 - lambda*k) dt + sigma*sqrt(dt)*Z + sum_{j=1..N} Y_j
+ *   N ~ Poisson(lambda*dt),  k = E[exp(Y)] - 1 (compensator keeps the drift at mu)
+ *
+ * Jump counts are drawn by inversion from one uniform per instrument. The
+ * zero-jump probability exp(-lambda*dt) is precomputed, so the common case
+ * (no jump this step) costs a single compare. The sum of N normal jumps is
+ * itself normal, N(N*jumpMean, N*jumpStdDev^2), so one extra draw covers any count.
+ */
+template <Arithmetic PriceType>
+class MertonJumpDiffusionGenerator : public IBatchPriceGenerator<PriceType>
+{
+public:
+    // Inversion is cut off here, P(N > 16) is negligible for per-tick lambda*dt
+    static constexpr uint32_t MAX_JUMPS_PER_STEP = 16;
+
+    MertonJumpDiffusionGenerator(std::size_t instruments, PriceType startPrice, const MertonParameters &params,
+                                 double dt_s, uint64_t seed = std::random_device{}())
+        : params_{params},
+          lambdaDt_{params.lambda * dt_s},
+          zeroJumpProbability_{std::exp(-params.lambda * dt_s)},
+          diffusion_{params.sigma * std::sqrt(dt_s)},
+          prices_(instruments, startPrice > 0 ? startPrice : PriceType{1}),
+          jumpCounts_(instruments, 0),
+          rngEngine_{seed},
+          normalDistribution_{0.0, 1.0},
+          uniformDistribution_{0.0, 1.0}
+    {
+        double k = std::exp(params.jumpMean + 0.5 * params.jumpStdDev * params.jumpStdDev) - 1.0;
+        drift_ = (params.mu - 0.5 * params.sigma * params.sigma - params.lambda * k) * dt_s;
+    }
+
+    void step() override
+    {
+        const std::size_t n = prices_.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // 1. Diffusive part
+            double logReturn = drift_ + diffusion_ * normalDistribution_(rngEngine_);
+
+            // 2. Jump count (fast path: no jump)
+            uint32_t jumps = drawJumpCount(uniformDistribution_(rngEngine_));
+            if (jumps > 0)
+            {
+                double m = jumps * params_.jumpMean;
+                double s = std::sqrt(static_cast<double>(jumps)) * params_.jumpStdDev;
+                logReturn += m + s * normalDistribution_(rngEngine_);
+            }
+            jumpCounts_[i] = jumps;
+
+            prices_[i] *= std::exp(logReturn);
+        }
+    }
+
+    std::span<const PriceType> prices() const override { return {prices_.data(), prices_.size()}; }
+    std::size_t size() const override { return prices_.size(); }
+
+    // Number of jumps each instrument took on the last step (gap-move marker)
+    std::span<const uint32_t> jumpCounts() const { return {jumpCounts_.data(), jumpCounts_.size()}; }
+
+private:
+    MertonParameters params_;
+    double lambdaDt_;
+    double zeroJumpProbability_; // exp(-lambda*dt)
+    double drift_;               // Compensated drift per step
+    double diffusion_;           // sigma * sqrt(dt)
+
+    std::vector<PriceType> prices_;
+    std::vector<uint32_t> jumpCounts_;
+
+    std::mt19937_64 rngEngine_;
+    std::normal_distribution<double> normalDistribution_;
+    std::uniform_real_distribution<double> uniformDistribution_;
+
+    /**
+     * @brief Poisson(lambda*dt) by inversion of the CDF.
+     *
+     * P(N=k) = P(N=k-1) * lambda*dt / k, so each extra step is one multiply.
+     */
+    uint32_t drawJumpCount(double u) const
+    {
+        double p = zeroJumpProbability_;
+        if (u < p)
+        {
+            return 0;
+        }
+
+        double cdf = p;
+        uint32_t k = 0;
+        while (u >= cdf && k < MAX_JUMPS_PER_STEP)
+        {
+            ++k;
+            p *= lambdaDt_ / k;
+            cdf += p;
+        }
+        return k;
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_MERTON_JUMP_DIFFUSION_GENERATOR_H
@@ -0,0 +1,221 @@
+#ifndef MARKET_DATA_SYSTEM_PARALLEL_TICK_GENERATOR_H
+#define MARKET_DATA_SYSTEM_PARALLEL_TICK_GENERATOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <core/nonblocking_ring_buffer.h>
+#include <core/tsc_clock.h>
+#include <core/xoshiro256.h>
+#include <market/tick_tape.h>
+#include <market/gbm_instrument.h>
+
+struct ParallelGenerationConfig
+{
+    std::size_t instruments = 1000;
+    std::size_t workers = 1;
+    double ratePerInstrument = 1000.0; // Poisson ticks / second per instrument
+    double startPrice = 100.0;
+    double mu = 0.1;
+    double sigma = 0.3;
+    double dt = 0.001; // GBM step per tick (years)
+    uint64_t seed = 42;
+};
+
+/**
+ * @brief Multi-threaded GBM tick generation with a deterministic merge.
+ *
+ * The instrument universe is split into K contiguous ranges, one per worker
+ * thread. Every instrument owns its own xoshiro256++ stream (seed + id jumps),
+ * its price and its Poisson arrival clock, so the ticks an instrument produces
+ * do not depend on which worker runs it or how fast that worker is.
+ *
+ * Each worker emits its instruments in (timestampNs, symbolId) order into a
+ * private SPSC ring. The sequencer (the thread calling run()) keeps one head
+ * record per worker and always releases the smallest (timestampNs, symbolId).
+ * Because both sides use the same key, the merged stream is byte-identical for
+ * any K.
+ *
+ * Records reuse the TapeRecord layout so the output can go straight to a
+ * TapeWriter or into a ring.
+ */
+class ParallelTickGenerator
+{
+public:
+    static constexpr std::size_t RING_CAPACITY = 16384;
+
+    explicit ParallelTickGenerator(const ParallelGenerationConfig &config)
+        : config_{config}
+    {
+        if (config.instruments == 0 || config.workers == 0)
+        {
+            throw std::invalid_argument("ParallelTickGenerator: instruments and workers must be > 0");
+        }
+        if (config.workers > config.instruments)
+        {
+            throw std::invalid_argument("ParallelTickGenerator: more workers than instruments");
+        }
+        if (config.ratePerInstrument <= 0.0)
+        {
+            throw std::invalid_argument("ParallelTickGenerator: rate must be positive");
+        }
+
+        // 1. One RNG stream per instrument, each 2^128 draws after the previous
+        Xoshiro256PlusPlus stream{config.seed};
+
+        // 2. Contiguous ranges, the first (N % K) workers take one extra instrument
+        const std::size_t base = config.instruments / config.workers;
+        const std::size_t extra = config.instruments % config.workers;
+        uint32_t nextId = 0;
+
+        for (std::size_t w = 0; w < config.workers; ++w)
+        {
+            auto worker = std::make_unique<Worker>();
+            const std::size_t count = base + (w < extra ? 1 : 0);
+            worker->instruments.reserve(count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                worker->instruments.emplace_back(stream, nextId++, config.startPrice, config.mu,
+                                                 config.sigma, config.dt, config.ratePerInstrument);
+                stream.jump();
+            }
+            workers_.push_back(std::move(worker));
+        }
+    }
+
+    /**
+     * @brief Generates every tick with timestampNs <= horizonNs, merged in order.
+     *
+     * @param sink     void(const TapeRecord &), called on this thread in global order
+     * @param running  Checked by workers and sequencer, generation stops when false
+     * @return Number of records handed to the sink
+     *
+     * Can only be called once: instrument state is consumed by the run.
+     */
+    template <typename SinkFn>
+    uint64_t run(uint64_t horizonNs, SinkFn &&sink, const std::atomic<bool> &running)
+    {
+        const std::size_t K = workers_.size();
+        uint64_t emitted = 0;
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(K);
+            for (auto &worker : workers_)
+            {
+                threads.emplace_back([this, &worker, horizonNs, &running]
+                                     { workerLoop(*worker, horizonNs, running); });
+            }
+
+            std::vector<TapeRecord> heads(K);
+            std::vector<uint8_t> hasHead(K, 0);
+            std::vector<uint8_t> exhausted(K, 0);
+
+            while (true)
+            {
+                // 1. Make sure every live worker has a head record (wait for it if needed)
+                for (std::size_t w = 0; w < K; ++w)
+                {
+                    if (hasHead[w] || exhausted[w])
+                        continue;
+
+                    Worker &worker = *workers_[w];
+                    while (!worker.ring.pop(heads[w]))
+                    {
+                        if (worker.done.load(std::memory_order_acquire))
+                        {
+                            // Re-check: the last records may have landed before done was set
+                            if (!worker.ring.pop(heads[w]))
+                                exhausted[w] = 1;
+                            break;
+                        }
+                        if (!running.load(std::memory_order_relaxed))
+                            return emitted;
+                        cpuRelax();
+                    }
+                    hasHead[w] = !exhausted[w];
+                }
+
+                // 2. Release the smallest (timestampNs, symbolId)
+                std::size_t best = K;
+                for (std::size_t w = 0; w < K; ++w)
+                {
+                    if (!hasHead[w])
+                        continue;
+                    if (best == K || before(heads[w], heads[best]))
+                        best = w;
+                }
+                if (best == K)
+                    break; // Every worker exhausted
+
+                sink(heads[best]);
+                hasHead[best] = 0;
+                ++emitted;
+            }
+        } // Workers joined here
+
+        return emitted;
+    }
+
+    std::size_t workerCount() const { return workers_.size(); }
+
+private:
+    struct Worker
+    {
+        std::vector<GbmInstrument> instruments;
+        LockFreeRingBuffer<TapeRecord, RING_CAPACITY> ring;
+        alignas(CACHE_LINE_SIZE) std::atomic<bool> done{false};
+    };
+
+    ParallelGenerationConfig config_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    static bool before(const TapeRecord &a, const TapeRecord &b)
+    {
+        return a.timestampNs != b.timestampNs ? a.timestampNs < b.timestampNs : a.symbolId < b.symbolId;
+    }
+
+    static void workerLoop(Worker &worker, uint64_t horizonNs, const std::atomic<bool> &running)
+    {
+        // Min-heap on the same key the sequencer merges by
+        using Key = std::pair<uint64_t, uint32_t>; // (timestampNs, local index)
+        std::priority_queue<Key, std::vector<Key>, std::greater<>> schedule;
+        for (uint32_t i = 0; i < worker.instruments.size(); ++i)
+        {
+            schedule.emplace(static_cast<uint64_t>(worker.instruments[i].clockNs), i);
+        }
+
+        // Local indices follow id order within a worker, so (ts, local) orders like (ts, id)
+        while (!schedule.empty() && running.load(std::memory_order_relaxed))
+        {
+            auto [timestampNs, local] = schedule.top();
+            if (timestampNs > horizonNs)
+                break; // Everything left is later still
+            schedule.pop();
+
+            GbmInstrument &instrument = worker.instruments[local];
+            TapeRecord record = instrument.nextTick(timestampNs);
+            schedule.emplace(static_cast<uint64_t>(instrument.clockNs), local);
+
+            // Hand over to the sequencer
+            while (!worker.ring.push(record))
+            {
+                if (!running.load(std::memory_order_relaxed))
+                    break;
+                cpuRelax();
+            }
+        }
+
+        worker.done.store(true, std::memory_order_release);
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_PARALLEL_TICK_GENERATOR_H
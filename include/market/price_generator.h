@@ -2,6 +2,8 @@
 // Created by Anthony Nguyen on 13/11/2025.
 //
 #include <type_traits>
+#include <cstddef>
+#include <span>
 
 
 #ifndef MARKET_DATA_SYSTEM_PRICE_GENERATOR_H
@@ -23,5 +25,26 @@ public:
    virtual PriceType getNextPrice() = 0;
 };
 
+/**
+ * @brief Batch price generator interface (many instruments per call)
+ *
+ * One virtual call advances every instrument by a single time step, prices
+ * are then read back as a contiguous (SoA) array indexed by instrument.
+ */
+template<Arithmetic PriceType>
+class IBatchPriceGenerator
+{
+public:
+   virtual ~IBatchPriceGenerator() = default;
+
+   // Advance every instrument by one time step
+   virtual void step() = 0;
+
+   // Prices after the last step, index i belongs to instrument i
+   virtual std::span<const PriceType> prices() const = 0;
+
+   virtual std::size_t size() const = 0;
+};
+
 
-#endif //MARKET_DATA_SYSTEM_PRICE_GENERATOR_H
\ No newline at end of file
+#endif //MARKET_DATA_SYSTEM_PRICE_GENERATOR_H
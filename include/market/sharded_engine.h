@@ -0,0 +1,318 @@
+#ifndef MARKET_DATA_SYSTEM_SHARDED_ENGINE_H
+#define MARKET_DATA_SYSTEM_SHARDED_ENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <market/market_data_engine.h>
+
+/**
+ * @brief Instrument -> shard assignment.
+ *
+ * Hash: FNV-1a of the symbol name modulo the shard count, stable across
+ * runs and builds so a receiver knows which group carries a symbol.
+ * Explicit: a symbol -> shard map; every symbol must be listed.
+ */
+class ShardPartition
+{
+public:
+    static ShardPartition hash(std::size_t shards) { return ShardPartition(shards, {}); }
+
+    static ShardPartition explicitMap(std::size_t shards, std::unordered_map<std::string, std::size_t> map)
+    {
+        for (const auto &[symbol, shard] : map)
+        {
+            if (shard >= shards)
+                throw std::invalid_argument("ShardPartition: " + symbol + " mapped to shard " + std::to_string(shard) +
+                                            " of " + std::to_string(shards));
+        }
+        return ShardPartition(shards, std::move(map));
+    }
+
+    std::size_t shards() const { return shards_; }
+
+    std::size_t shardOf(std::string_view symbol) const
+    {
+        if (map_.empty())
+            return fnv1a(symbol) % shards_;
+        auto it = map_.find(std::string(symbol));
+        if (it == map_.end())
+            throw std::invalid_argument("ShardPartition: no shard for " + std::string(symbol));
+        return it->second;
+    }
+
+    // Symbols of each shard, in input order
+    std::vector<std::vector<std::string>> split(const std::vector<std::string> &symbols) const
+    {
+        std::vector<std::vector<std::string>> parts(shards_);
+        for (const auto &symbol : symbols)
+        {
+            parts[shardOf(symbol)].push_back(symbol);
+        }
+        return parts;
+    }
+
+private:
+    std::size_t shards_;
+    std::unordered_map<std::string, std::size_t> map_;
+
+    ShardPartition(std::size_t shards, std::unordered_map<std::string, std::size_t> map)
+        : shards_{shards},
+          map_{std::move(map)}
+    {
+        if (shards_ == 0)
+            throw std::invalid_argument("ShardPartition: need at least one shard");
+    }
+
+    static uint64_t fnv1a(std::string_view s)
+    {
+        uint64_t h = 14695981039346656037ULL;
+        for (unsigned char c : s)
+        {
+            h ^= c;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+};
+
+/**
+ * @brief Destination of shard i: base group + i in the last octet, base port + i.
+ *
+ * 239.255.1.1:9999 -> shard 2 sends to 239.255.1.3:10001. Distinct groups
+ * let a receiver join only the partitions it needs; distinct ports keep
+ * shards apart on unicast / loopback test beds too.
+ */
+inline TransportConfig shardTransport(const TransportConfig &base, std::size_t shard)
+{
+    TransportConfig config = base;
+    std::size_t dot = base.destIp.rfind('.');
+    if (dot != std::string::npos)
+    {
+        int octet = std::stoi(base.destIp.substr(dot + 1)) + static_cast<int>(shard);
+        if (octet > 254)
+            throw std::invalid_argument("shardTransport: " + base.destIp + " + " + std::to_string(shard) + " leaves the /24");
+        config.destIp = base.destIp.substr(0, dot + 1) + std::to_string(octet);
+    }
+    config.port = static_cast<uint16_t>(base.port + shard);
+    return config;
+}
+
+/**
+ * @brief N independent MarketDataEngine pipelines over a partitioned universe.
+ *
+ * Each shard owns its generator (over its partition of the instruments),
+ * ring, encoder and transport (own socket, own group / port), so shards
+ * share nothing on the hot path and scale until cores or the NIC run out.
+ * The per-shard monitors are replaced by one monitor that prints totals,
+ * the per-shard split, the stage latencies merged over all shards and the
+ * average busy share of each stage.
+ *
+ * @tparam Engine  A MarketDataEngine whose Generator is constructible from
+ *                 (SymbolRegistry &, const std::vector<std::string> &, Args...),
+ *                 i.e. a multi-instrument source such as CorrelatedGBMSource.
+ */
+template <typename Engine>
+class ShardedEngine
+{
+public:
+    /**
+     * @param symbols        Whole instrument universe
+     * @param partition      Assignment of symbols to shards (shard count included)
+     * @param transport      Base destination, see shardTransport()
+     * @param generatorArgs  Forwarded to every shard's generator after its symbol list
+     */
+    template <typename... GeneratorArgs>
+    ShardedEngine(const std::vector<std::string> &symbols, const ShardPartition &partition,
+                  const TransportConfig &transport, const GeneratorArgs &...generatorArgs)
+    {
+        auto parts = partition.split(symbols);
+        for (std::size_t i = 0; i < parts.size(); ++i)
+        {
+            if (parts[i].empty())
+                throw std::invalid_argument("ShardedEngine: shard " + std::to_string(i) + " has no instruments");
+            auto &engine = shards_.emplace_back(std::make_unique<Engine>(shardTransport(transport, i), parts[i], generatorArgs...));
+            engine->setMonitorEnabled(false);
+            engine->setThreadTag("md" + std::to_string(i));
+            logInfo("Shard {}: {} instruments", i, parts[i].size());
+        }
+    }
+
+    ~ShardedEngine()
+    {
+        join();
+    }
+
+    ShardedEngine(const ShardedEngine &) = delete;
+    ShardedEngine &operator=(const ShardedEngine &) = delete;
+
+    std::size_t size() const { return shards_.size(); }
+    Engine &shard(std::size_t i) { return *shards_[i]; }
+
+    // Same pacing spec on every shard (the rate is per shard)
+    void setPacing(std::string_view spec)
+    {
+        for (auto &engine : shards_)
+            engine->setPacing(spec);
+    }
+
+    // Same layout on every shard (see PipelineMode)
+    void setPipelineMode(PipelineMode mode)
+    {
+        mode_ = mode;
+        for (auto &engine : shards_)
+            engine->setPipelineMode(mode);
+    }
+
+    // Same send batch on every shard (see MarketDataEngine::setSendBatch)
+    void setSendBatch(std::size_t batch)
+    {
+        for (auto &engine : shards_)
+            engine->setSendBatch(batch);
+    }
+
+    /**
+     * @brief Pins shard i's hot threads to consecutive CPUs of hotCpus.
+     *
+     * Two-stage: producer / consumer on hotCpus[2i] / hotCpus[2i + 1].
+     * Three-stage: producer / encoder / consumer on hotCpus[3i .. 3i + 2].
+     * Applied by start(), so the pipeline mode may be set either side of
+     * this call. Shards beyond the list stay unpinned. The monitor role and
+     * the SCHED_FIFO priority / isolation requirement are taken from base.
+     */
+    void setThreadPlacement(const ThreadPlacement &base, const std::vector<int> &hotCpus)
+    {
+        basePlacement_ = base;
+        hotCpus_ = hotCpus;
+    }
+
+    void setMonitorEnabled(bool enabled) { monitorEnabled_ = enabled; }
+
+    void start()
+    {
+        applyPlacement();
+        for (auto &engine : shards_)
+            engine->start();
+        if (monitorEnabled_)
+        {
+            monitor_ = std::jthread([this]
+                                    {
+                applyThreadPlacement("md-monitor", basePlacement_.monitor);
+                monitorThread(); });
+        }
+    }
+
+    void stop()
+    {
+        running_.store(false, std::memory_order_relaxed);
+        CVMonitor_.notify_all();
+        for (auto &engine : shards_)
+            engine->stop();
+    }
+
+    // Stop and join every shard
+    void join()
+    {
+        stop();
+        if (monitor_.joinable())
+            monitor_.join();
+        for (auto &engine : shards_)
+            engine->join();
+    }
+
+    // Totals over all shards since start()
+    uint64_t getGeneratedCount() const
+    {
+        uint64_t total = 0;
+        for (const auto &engine : shards_)
+            total += engine->getGeneratedCount();
+        return total;
+    }
+
+    uint64_t getSentCount() const
+    {
+        uint64_t total = 0;
+        for (const auto &engine : shards_)
+            total += engine->getSentCount();
+        return total;
+    }
+
+private:
+    std::vector<std::unique_ptr<Engine>> shards_;
+    PipelineMode mode_ = PipelineMode::TwoStage;
+    ThreadPlacement basePlacement_;
+    std::vector<int> hotCpus_;
+    bool monitorEnabled_ = true;
+
+    std::atomic<bool> running_{true};
+    std::condition_variable CVMonitor_;
+    std::mutex CVMutex_;
+    std::jthread monitor_;
+
+    void applyPlacement()
+    {
+        const bool threeStage = mode_ == PipelineMode::ThreeStage;
+        const std::size_t perShard = threeStage ? 3 : 2;
+        for (std::size_t i = 0; i < shards_.size(); ++i)
+        {
+            ThreadPlacement placement = basePlacement_;
+            if (perShard * (i + 1) <= hotCpus_.size())
+            {
+                const int *cpus = &hotCpus_[perShard * i];
+                placement.producer.cpus = {cpus[0]};
+                if (threeStage)
+                    placement.encoder.cpus = {cpus[1]};
+                placement.consumer.cpus = {cpus[perShard - 1]};
+            }
+            shards_[i]->setThreadPlacement(std::move(placement));
+        }
+    }
+
+    void monitorThread()
+    {
+        // Every shard's threads merged into one view
+        std::vector<const MetricsRegistry *> registries;
+        for (const auto &engine : shards_)
+            registries.push_back(&engine->metrics());
+        MetricsCollector collector(std::move(registries));
+
+        std::vector<uint64_t> lastSent(shards_.size(), 0);
+        uint64_t lastTsc = readTsc();
+        while (running_.load(std::memory_order_relaxed))
+        {
+            std::unique_lock<std::mutex> lock(CVMutex_);
+            bool stopping = CVMonitor_.wait_for(lock, std::chrono::seconds(1), [this]
+                                                { return !running_.load(std::memory_order_relaxed); });
+            if (stopping)
+                break;
+
+            collector.collect();
+            const uint64_t nowTsc = readTsc();
+            logPipelineMetrics(collector);
+            logStageUtilization(collector, nowTsc - lastTsc, mode_, shards_.size());
+            lastTsc = nowTsc;
+
+            std::string perShard;
+            for (std::size_t i = 0; i < shards_.size(); ++i)
+            {
+                uint64_t sent = shards_[i]->getSentCount();
+                perShard += (i ? ", " : "") + std::to_string(sent - lastSent[i]);
+                lastSent[i] = sent;
+            }
+            logInfo("[Shards] Sent / secs per shard: {}", perShard);
+        }
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_SHARDED_ENGINE_H
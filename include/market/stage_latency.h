@@ -0,0 +1,120 @@
+#ifndef MARKET_DATA_SYSTEM_STAGE_LATENCY_H
+#define MARKET_DATA_SYSTEM_STAGE_LATENCY_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <core/async_logger.h>
+#include <core/latency_histogram.h>
+#include <core/metrics_registry.h>
+#include <core/tsc_clock.h>
+#include <market/encoded_message.h>
+#include <market/market_tick.h>
+#include <network/tx_timestamps.h>
+
+/**
+ * @file stage_latency.h
+ * @brief Per-tick latency of every pipeline stage, generation to send return.
+ *
+ *   generated_tsc -> enqueue_tsc      Produce   (tick build, pacing excluded)
+ *   enqueue_tsc   -> dequeue          Queue     (push incl. full-ring retries, ring residence)
+ *   dequeue       -> encode done      Encode    (three-stage: incl. waiting for encoded-ring space)
+ *   encode done   -> sender dequeue   Handoff   (three-stage only: encoded ring residence)
+ *   encode done / sender dequeue
+ *                 -> send return      Send      (sendto / transport)
+ *   generated_tsc -> send return      Total
+ *
+ * The producer stamps the first two into the MarketTick, the thread that
+ * sends takes or receives the rest and records every delta (TSC ticks)
+ * into histograms of its own ThreadMetrics, so nothing is shared on the
+ * hot path. The monitor merges them through a MetricsCollector.
+ *
+ *   send call     -> TX timestamp     TxQueue   (--tx-timestamps: stack, qdisc and device queue,
+ *                                                recorded by the TxTimestamps reader thread)
+ */
+enum class LatencyStage : std::size_t
+{
+    Produce,
+    Queue,
+    Encode,
+    Handoff,
+    Send,
+    Total,
+};
+
+inline constexpr std::size_t LATENCY_STAGES = 6;
+inline constexpr const char *LATENCY_STAGE_NAMES[LATENCY_STAGES] = {"latency.produce", "latency.queue", "latency.encode",
+                                                                    "latency.handoff", "latency.send", "latency.total"};
+
+// The sending thread's stage histograms, slots of its ThreadMetrics
+class StageLatency
+{
+public:
+    StageLatency(MetricsRegistry &registry, ThreadMetrics &metrics)
+    {
+        for (std::size_t s = 0; s < LATENCY_STAGES; ++s)
+        {
+            stages_[s] = &metrics.histogram(registry.histogram(LATENCY_STAGE_NAMES[s]));
+        }
+    }
+
+    // Two-stage consumer, once per published tick
+    void record(const MarketTick &tick, uint64_t dequeueTsc, uint64_t encodedTsc, uint64_t sentTsc) noexcept
+    {
+        stage(LatencyStage::Produce).record(tick.enqueue_tsc - tick.generated_tsc);
+        stage(LatencyStage::Queue).record(dequeueTsc - tick.enqueue_tsc);
+        stage(LatencyStage::Encode).record(encodedTsc - dequeueTsc);
+        stage(LatencyStage::Send).record(sentTsc - encodedTsc);
+        stage(LatencyStage::Total).record(sentTsc - tick.generated_tsc);
+    }
+
+    // Two-stage batched send, once per sent message (no hand-off between encode and send)
+    void record(const EncodedMessageHeader &message, uint64_t sentTsc) noexcept
+    {
+        stage(LatencyStage::Produce).record(message.enqueue_tsc - message.generated_tsc);
+        stage(LatencyStage::Queue).record(message.dequeue_tsc - message.enqueue_tsc);
+        stage(LatencyStage::Encode).record(message.encoded_tsc - message.dequeue_tsc);
+        stage(LatencyStage::Send).record(sentTsc - message.encoded_tsc);
+        stage(LatencyStage::Total).record(sentTsc - message.generated_tsc);
+    }
+
+    // Three-stage sender, once per sent message (stamps carried over from the encoder)
+    void record(const EncodedMessageHeader &message, uint64_t handoffTsc, uint64_t sentTsc) noexcept
+    {
+        stage(LatencyStage::Produce).record(message.enqueue_tsc - message.generated_tsc);
+        stage(LatencyStage::Queue).record(message.dequeue_tsc - message.enqueue_tsc);
+        stage(LatencyStage::Encode).record(message.encoded_tsc - message.dequeue_tsc);
+        stage(LatencyStage::Handoff).record(handoffTsc - message.encoded_tsc);
+        stage(LatencyStage::Send).record(sentTsc - handoffTsc);
+        stage(LatencyStage::Total).record(sentTsc - message.generated_tsc);
+    }
+
+    LatencyHistogram &stage(LatencyStage s) { return *stages_[static_cast<std::size_t>(s)]; }
+
+private:
+    std::array<LatencyHistogram *, LATENCY_STAGES> stages_{};
+};
+
+// One [Latency] line per stage (TX queue last) with samples in the collector's last interval
+inline void logStageLatency(const MetricsCollector &metrics)
+{
+    std::array<std::string_view, LATENCY_STAGES + 1> names{};
+    std::copy(std::begin(LATENCY_STAGE_NAMES), std::end(LATENCY_STAGE_NAMES), names.begin());
+    names.back() = TX_QUEUE_LATENCY_NAME;
+    for (std::string_view name : names)
+    {
+        LatencySummary summary = metrics.histogram(name);
+        if (summary.count == 0)
+            continue;
+        logInfo("[Latency] {:<8} p50 = {:>9.0f}ns, p99 = {:>9.0f}ns, p99.9 = {:>9.0f}ns, max = {:>9.0f}ns ({} ticks)",
+                name.substr(8), TscClock::toNs(summary.p50), TscClock::toNs(summary.p99),
+                TscClock::toNs(summary.p999), TscClock::toNs(summary.max), summary.count);
+    }
+    if (uint64_t unmatched = metrics.delta("tx_timestamps_unmatched"))
+        logWarn("[Latency] {} TX timestamps unmatched: the timestamp reader fell behind", unmatched);
+}
+
+#endif // MARKET_DATA_SYSTEM_STAGE_LATENCY_H
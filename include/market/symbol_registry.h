@@ -0,0 +1,74 @@
+#ifndef MARKET_DATA_SYSTEM_SYMBOL_REGISTRY_H
+#define MARKET_DATA_SYSTEM_SYMBOL_REGISTRY_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <unordered_map>
+#include <stdexcept>
+
+/**
+ * @brief Maps instrument names to dense uint32 IDs, built once at startup.
+ *
+ * Alongside each name the registry keeps the pre-rendered FIX field
+ * "55=<name><SOH>" in one contiguous buffer, so the encoder appends the
+ * symbol with a single copy instead of formatting a tag and a string.
+ *
+ * Not thread-safe: intern() everything before the hot threads start,
+ * lookups by ID are read-only afterwards.
+ */
+class SymbolRegistry
+{
+public:
+    static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+    // Returns the existing ID if the name is already registered
+    uint32_t intern(std::string_view name)
+    {
+        auto it = ids_.find(std::string(name));
+        if (it != ids_.end())
+            return it->second;
+
+        if (name.empty())
+            throw std::invalid_argument("SymbolRegistry: empty symbol");
+
+        uint32_t id = static_cast<uint32_t>(names_.size());
+        ids_.emplace(std::string(name), id);
+        names_.emplace_back(name);
+
+        // "55=" + name + SOH
+        fieldOffsets_.push_back(static_cast<uint32_t>(fieldBytes_.size()));
+        fieldBytes_.insert(fieldBytes_.end(), {'5', '5', '='});
+        fieldBytes_.insert(fieldBytes_.end(), name.begin(), name.end());
+        fieldBytes_.push_back('\x01');
+        fieldEnds_.push_back(static_cast<uint32_t>(fieldBytes_.size()));
+        return id;
+    }
+
+    uint32_t find(std::string_view name) const
+    {
+        auto it = ids_.find(std::string(name));
+        return it == ids_.end() ? INVALID_ID : it->second;
+    }
+
+    std::string_view name(uint32_t id) const { return names_[id]; }
+
+    // Pre-rendered "55=<name><SOH>" for the encoder
+    std::span<const uint8_t> fixField(uint32_t id) const
+    {
+        return {fieldBytes_.data() + fieldOffsets_[id], fieldEnds_[id] - fieldOffsets_[id]};
+    }
+
+    std::size_t size() const { return names_.size(); }
+
+private:
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::vector<std::string> names_;
+    std::vector<uint8_t> fieldBytes_;
+    std::vector<uint32_t> fieldOffsets_;
+    std::vector<uint32_t> fieldEnds_;
+};
+
+#endif // MARKET_DATA_SYSTEM_SYMBOL_REGISTRY_H
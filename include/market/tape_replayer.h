@@ -0,0 +1,90 @@
+#ifndef MARKET_DATA_SYSTEM_TAPE_REPLAYER_H
+#define MARKET_DATA_SYSTEM_TAPE_REPLAYER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <market/tick_tape.h>
+#include <core/tsc_pacer.h>
+
+// Replay speed: honour the recorded timestamps, or emit back-to-back
+enum class ReplayTiming
+{
+    Original,
+    AsFastAsPossible
+};
+
+// Where replayed records enter the pipeline
+enum class ReplayTarget
+{
+    Ring,   // Producer thread pushes ticks into the SPSC ring (consumer unchanged)
+    Encoder // Consumer thread reads the tape itself, no producer / ring hop
+};
+
+/**
+ * @brief Walks an mmap'd tape and hands each record to a callback.
+ *
+ * In Original timing the gaps between recorded timestamps are reproduced
+ * with a TscPacer, otherwise records are emitted as fast as the callback
+ * accepts them. With loop enabled the tape restarts (timestamps continue
+ * from the end of the previous pass).
+ */
+class TapeReplayer
+{
+public:
+    TapeReplayer(const std::string &path, ReplayTiming timing, bool loop = true)
+        : tape_{path},
+          timing_{timing},
+          loop_{loop}
+    {
+    }
+
+    /**
+     * @param emit     bool(const TapeRecord &), return false to stop the replay
+     * @param running  Checked once per record, replay stops when false
+     * @return Number of records emitted
+     */
+    template <typename EmitFn>
+    uint64_t replay(EmitFn &&emit, const std::atomic<bool> &running)
+    {
+        auto records = tape_.records();
+        if (records.empty())
+            return 0;
+
+        TscPacer pacer;
+        uint64_t emitted = 0;
+        uint64_t previousNs = 0;
+
+        do
+        {
+            previousNs = 0;
+            for (const TapeRecord &record : records)
+            {
+                if (!running.load(std::memory_order_relaxed))
+                    return emitted;
+
+                if (timing_ == ReplayTiming::Original)
+                {
+                    pacer.wait(static_cast<double>(record.timestampNs - previousNs));
+                    previousNs = record.timestampNs;
+                }
+
+                if (!emit(record))
+                    return emitted;
+                ++emitted;
+            }
+        } while (loop_);
+
+        return emitted;
+    }
+
+    const TapeReader &tape() const { return tape_; }
+
+private:
+    TapeReader tape_;
+    ReplayTiming timing_;
+    bool loop_;
+};
+
+#endif // MARKET_DATA_SYSTEM_TAPE_REPLAYER_H
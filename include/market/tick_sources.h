@@ -0,0 +1,154 @@
+#ifndef MARKET_DATA_SYSTEM_TICK_SOURCES_H
+#define MARKET_DATA_SYSTEM_TICK_SOURCES_H
+
+#include <cstdint>
+#include <cstdlib> // For std::rand
+#include <cmath>
+#include <string>
+#include <vector>
+#include <span>
+#include <concepts>
+
+#include <market/market_tick.h>
+#include <market/symbol_registry.h>
+#include <market/geometric_brownian_motion_generator.h>
+#include <market/random_walk_generator.h>
+#include <market/correlated_gbm_generator.h>
+
+/**
+ * @file tick_sources.h
+ * @brief Generator policies for MarketDataEngine.
+ *
+ * A source registers its instruments once (constructor, first argument is
+ * the engine's SymbolRegistry) and then fills symbol_id, bid/ask and sizes
+ * of one tick per next() call. Sequence and timestamps belong to the engine.
+ * Sources are held by value, so the price model call inlines into the
+ * producer loop instead of going through IPriceGenerator.
+ */
+template <typename S>
+concept TickSource = requires(S source, MarketTick &tick) {
+    { source.next(tick) } -> std::same_as<void>;
+};
+
+// Bid/ask around a mid: 5-6 cent spread rounded to the cent, 50-150 lots a side
+inline void quoteAroundMid(MarketTick &tick, double mid)
+{
+    double spread = 0.05 + 0.01 * ((double)std::rand() / RAND_MAX);
+    spread = std::round(spread * 100.0) / 100.0;
+
+    tick.bid = mid - spread / 2.0;
+    tick.ask = mid + spread / 2.0;
+    tick.bid_size = (std::rand() % 100) + 50;
+    tick.ask_size = tick.bid_size;
+}
+
+/**
+ * @brief Single instrument, GBM with a weak pull back to the start price.
+ *
+ * The reversion stops the price collapsing from floating point error
+ * accumulation over long runs.
+ */
+class MeanRevertingGBMSource
+{
+public:
+    static constexpr double TARGET_PRICE = 100.0;
+    static constexpr double REVERSION_STRENGTH = 0.00005;
+
+    explicit MeanRevertingGBMSource(SymbolRegistry &symbols, std::string_view symbol = "ESZ5")
+        : symbolId_{symbols.intern(symbol)},
+          // GBM: (startPrice, mu, sigma, dt)
+          model_{TARGET_PRICE, 0.1, 0.3, 0.001}
+    {
+    }
+
+    void next(MarketTick &tick)
+    {
+        double mid = model_.getNextPrice();
+        mid += (TARGET_PRICE - mid) * REVERSION_STRENGTH;
+
+        tick.symbol_id = symbolId_;
+        quoteAroundMid(tick, mid);
+    }
+
+    static constexpr const char *name() { return "GBM"; }
+
+private:
+    uint32_t symbolId_;
+    GBMGenerator<double> model_;
+};
+
+/**
+ * @brief Single instrument, fixed-size random walk (no pacing dependency).
+ */
+class RandomWalkSource
+{
+public:
+    explicit RandomWalkSource(SymbolRegistry &symbols, std::string_view symbol = "ESZ5")
+        : symbolId_{symbols.intern(symbol)},
+          // Random walk: (startPrice, stepSize)
+          model_{100.0, 0.01}
+    {
+    }
+
+    void next(MarketTick &tick)
+    {
+        tick.symbol_id = symbolId_;
+        quoteAroundMid(tick, model_.getNextPrice());
+    }
+
+    static constexpr const char *name() { return "RW"; }
+
+private:
+    uint32_t symbolId_;
+    RandomWalkGenerator<double> model_;
+};
+
+/**
+ * @brief Many instruments from one correlated GBM batch step.
+ *
+ * next() walks the instruments in order and steps the whole universe each
+ * time the cursor wraps, so every step yields one tick per symbol.
+ */
+class CorrelatedGBMSource
+{
+public:
+    /**
+     * @param names  Instrument names, index i is priced by instrument i of the generator
+     * @param rho    Uniform pairwise correlation between instruments
+     */
+    CorrelatedGBMSource(SymbolRegistry &symbols, const std::vector<std::string> &names, double rho = 0.3)
+        // Correlated GBM: (instruments, startPrice, mu, sigma, rho, dt)
+        : model_{names.size(), 100.0, 0.1, 0.3, rho, 0.001}
+    {
+        // Instrument i -> registry ID, resolved once so the hot path never touches names
+        symbolIds_.reserve(names.size());
+        for (const auto &n : names)
+        {
+            symbolIds_.push_back(symbols.intern(n));
+        }
+    }
+
+    void next(MarketTick &tick)
+    {
+        if (cursor_ == 0)
+        {
+            model_.step();
+        }
+        tick.symbol_id = symbolIds_[cursor_];
+        quoteAroundMid(tick, model_.prices()[cursor_]);
+
+        if (++cursor_ == symbolIds_.size())
+            cursor_ = 0;
+    }
+
+    std::size_t size() const { return symbolIds_.size(); }
+
+    static constexpr const char *name() { return "CorrelatedGBM"; }
+
+private:
+    CorrelatedGBMGenerator<double> model_;
+    std::vector<uint32_t> symbolIds_;
+    std::size_t cursor_ = 0;
+};
+
+#endif // MARKET_DATA_SYSTEM_TICK_SOURCES_H
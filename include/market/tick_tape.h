@@ -0,0 +1,227 @@
+#ifndef MARKET_DATA_SYSTEM_TICK_TAPE_H
+#define MARKET_DATA_SYSTEM_TICK_TAPE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <algorithm>
+
+// --- POSIX mmap ---
+#include <sys/mman.h> // For mmap(), munmap(), madvise()
+#include <sys/stat.h> // For fstat()
+#include <fcntl.h>    // For open()
+#include <unistd.h>   // For close()
+
+/**
+ * @file tick_tape.h
+ * @brief Binary scenario tape: pre-generated ticks replayed without generation cost.
+ *
+ * FILE LAYOUT:
+ *
+ * [ TapeHeader (64) | TapeSymbol x symbolCount (16 each) | pad to 64 | TapeRecord x recordCount (40 each) ]
+ *
+ * Everything is fixed-size and native-endian so the reader can mmap the file
+ * and hand out a span of records directly, no parsing or copying.
+ */
+
+constexpr uint32_t TAPE_MAGIC = 0x45504154; // "TAPE" little-endian
+constexpr uint32_t TAPE_VERSION = 1;
+constexpr std::size_t TAPE_SYMBOL_LENGTH = 16;
+
+struct TapeHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;   // sizeof(TapeRecord), guards against layout changes
+    uint32_t symbolCount;
+    uint64_t recordCount;
+    uint64_t recordsOffset; // Byte offset of the first record (64-aligned)
+    uint64_t durationNs;    // Timestamp of the last record
+    char model[24];         // Generator name, informational only
+};
+
+struct TapeSymbol
+{
+    char name[TAPE_SYMBOL_LENGTH]; // NUL-padded
+};
+
+struct TapeRecord
+{
+    uint64_t timestampNs; // Offset from the start of the tape
+    double bid;
+    double ask;
+    uint32_t symbolId; // Index into the symbol table
+    int32_t bidSize;
+    int32_t askSize;
+    uint32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<TapeHeader> && sizeof(TapeHeader) == 64);
+static_assert(std::is_trivially_copyable_v<TapeSymbol> && sizeof(TapeSymbol) == TAPE_SYMBOL_LENGTH);
+static_assert(std::is_trivially_copyable_v<TapeRecord> && sizeof(TapeRecord) == 40);
+
+/**
+ * @brief Streams records to a tape file, header is patched on close().
+ */
+class TapeWriter
+{
+public:
+    TapeWriter(const std::string &path, const std::vector<std::string> &symbols, std::string_view model)
+        : out_{path, std::ios::binary | std::ios::trunc}
+    {
+        if (!out_)
+        {
+            throw std::runtime_error("TapeWriter: cannot open " + path);
+        }
+
+        std::memset(&header_, 0, sizeof(header_));
+        header_.magic = TAPE_MAGIC;
+        header_.version = TAPE_VERSION;
+        header_.recordSize = sizeof(TapeRecord);
+        header_.symbolCount = static_cast<uint32_t>(symbols.size());
+        std::memcpy(header_.model, model.data(), std::min(model.size(), sizeof(header_.model) - 1));
+
+        std::size_t symbolsEnd = sizeof(TapeHeader) + symbols.size() * sizeof(TapeSymbol);
+        header_.recordsOffset = (symbolsEnd + 63) & ~std::size_t{63};
+
+        // 1. Placeholder header (rewritten by close())
+        out_.write(reinterpret_cast<const char *>(&header_), sizeof(header_));
+
+        // 2. Symbol table
+        for (const auto &name : symbols)
+        {
+            if (name.size() >= TAPE_SYMBOL_LENGTH)
+            {
+                throw std::invalid_argument("TapeWriter: symbol too long: " + name);
+            }
+            TapeSymbol sym{};
+            std::memcpy(sym.name, name.data(), name.size());
+            out_.write(reinterpret_cast<const char *>(&sym), sizeof(sym));
+        }
+
+        // 3. Pad so records start on a cache line
+        std::vector<char> pad(header_.recordsOffset - symbolsEnd, 0);
+        out_.write(pad.data(), static_cast<std::streamsize>(pad.size()));
+    }
+
+    void write(const TapeRecord &record)
+    {
+        out_.write(reinterpret_cast<const char *>(&record), sizeof(record));
+        header_.recordCount++;
+        header_.durationNs = record.timestampNs;
+    }
+
+    void close()
+    {
+        if (!out_.is_open())
+            return;
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char *>(&header_), sizeof(header_));
+        out_.close();
+    }
+
+    ~TapeWriter() { close(); }
+
+    TapeWriter(const TapeWriter &) = delete;
+    TapeWriter &operator=(const TapeWriter &) = delete;
+
+    uint64_t recordCount() const { return header_.recordCount; }
+
+private:
+    std::ofstream out_;
+    TapeHeader header_;
+};
+
+/**
+ * @brief Read-only mmap view of a tape file (RAII).
+ */
+class TapeReader
+{
+public:
+    explicit TapeReader(const std::string &path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("TapeReader: cannot open " + path);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) < 0 || static_cast<std::size_t>(st.st_size) < sizeof(TapeHeader))
+        {
+            ::close(fd);
+            throw std::runtime_error("TapeReader: file too small " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+
+        // Map the whole file, the mapping keeps its own reference so fd can close now
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        flags |= MAP_POPULATE; // Pre-fault so replay never page-faults on the hot path
+#endif
+        void *addr = mmap(nullptr, size_, PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED)
+        {
+            throw std::runtime_error("TapeReader: mmap failed for " + path);
+        }
+        base_ = static_cast<const uint8_t *>(addr);
+        madvise(const_cast<uint8_t *>(base_), size_, MADV_SEQUENTIAL);
+
+        // Validate
+        std::memcpy(&header_, base_, sizeof(header_));
+        if (header_.magic != TAPE_MAGIC || header_.version != TAPE_VERSION || header_.recordSize != sizeof(TapeRecord))
+        {
+            unmap();
+            throw std::runtime_error("TapeReader: not a v1 tape file " + path);
+        }
+        if (header_.recordsOffset + header_.recordCount * sizeof(TapeRecord) > size_)
+        {
+            unmap();
+            throw std::runtime_error("TapeReader: truncated tape " + path);
+        }
+    }
+
+    ~TapeReader() { unmap(); }
+
+    TapeReader(const TapeReader &) = delete;
+    TapeReader &operator=(const TapeReader &) = delete;
+
+    const TapeHeader &header() const { return header_; }
+
+    std::span<const TapeRecord> records() const
+    {
+        return {reinterpret_cast<const TapeRecord *>(base_ + header_.recordsOffset), header_.recordCount};
+    }
+
+    std::string_view symbol(uint32_t id) const
+    {
+        const auto *sym = reinterpret_cast<const TapeSymbol *>(base_ + sizeof(TapeHeader)) + id;
+        return {sym->name, strnlen(sym->name, TAPE_SYMBOL_LENGTH)};
+    }
+
+    std::size_t symbolCount() const { return header_.symbolCount; }
+
+private:
+    const uint8_t *base_ = nullptr;
+    std::size_t size_ = 0;
+    TapeHeader header_{};
+
+    void unmap()
+    {
+        if (base_)
+        {
+            munmap(const_cast<uint8_t *>(base_), size_);
+            base_ = nullptr;
+        }
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_TICK_TAPE_H
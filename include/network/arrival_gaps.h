@@ -0,0 +1,112 @@
+#ifndef MARKET_DATA_SYSTEM_ARRIVAL_GAPS_H
+#define MARKET_DATA_SYSTEM_ARRIVAL_GAPS_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <core/latency_histogram.h>
+
+/**
+ * @brief Inter-arrival gaps of a packet stream, summarised per interval (pacing checks).
+ *
+ * record() takes each packet's receive time in ns; the gap to the previous
+ * packet lands in LatencyHistogram's log buckets (within 6.25%), so a
+ * paced stream shows as a narrow band around 1e9 / rate and a burst as a
+ * pile of gaps near zero at p1. With an expected gap, the share of gaps
+ * within TOLERANCE of it is counted too. One thread (the capture loop).
+ */
+class ArrivalGaps
+{
+public:
+    static constexpr double TOLERANCE = 0.10;
+
+    struct Summary
+    {
+        uint64_t gaps = 0;
+        double seconds = 0; // First to last arrival of the interval
+        uint64_t minNs = 0;
+        uint64_t p1Ns = 0;
+        uint64_t p50Ns = 0;
+        uint64_t p99Ns = 0;
+        uint64_t maxNs = 0;
+        double onTarget = 0; // Share of gaps within TOLERANCE of the expected gap (0 without one)
+    };
+
+    explicit ArrivalGaps(uint64_t expectedGapNs = 0) : expectedGapNs_{expectedGapNs} {}
+
+    void record(int64_t arrivalNs) noexcept
+    {
+        if (last_ != 0)
+        {
+            const uint64_t gap = static_cast<uint64_t>(std::max<int64_t>(arrivalNs - last_, 0));
+            ++counts_[LatencyHistogram::bucketOf(gap)];
+            ++gaps_;
+            min_ = std::min(min_, gap);
+            max_ = std::max(max_, gap);
+            const double error = static_cast<double>(gap) - static_cast<double>(expectedGapNs_);
+            if (expectedGapNs_ > 0 && std::abs(error) <= TOLERANCE * static_cast<double>(expectedGapNs_))
+                ++onTarget_;
+        }
+        if (first_ == 0)
+            first_ = arrivalNs;
+        last_ = arrivalNs;
+    }
+
+    // Nanoseconds since the first arrival of the current interval (0 before one)
+    int64_t elapsedNs(int64_t nowNs) const { return first_ == 0 ? 0 : nowNs - first_; }
+
+    // Gaps since the previous take(); the next interval starts at the last arrival
+    Summary take() noexcept
+    {
+        Summary summary;
+        summary.gaps = gaps_;
+        summary.seconds = static_cast<double>(last_ - first_) / 1e9;
+        if (gaps_ > 0)
+        {
+            summary.minNs = min_;
+            summary.maxNs = max_;
+            summary.p1Ns = percentile(0.01);
+            summary.p50Ns = percentile(0.50);
+            summary.p99Ns = percentile(0.99);
+            summary.onTarget = static_cast<double>(onTarget_) / static_cast<double>(gaps_);
+        }
+        counts_.fill(0);
+        gaps_ = 0;
+        onTarget_ = 0;
+        min_ = std::numeric_limits<uint64_t>::max();
+        max_ = 0;
+        first_ = last_;
+        return summary;
+    }
+
+private:
+    uint64_t expectedGapNs_;
+    std::array<uint64_t, LatencyHistogram::BUCKETS> counts_{};
+    uint64_t gaps_ = 0;
+    uint64_t onTarget_ = 0;
+    uint64_t min_ = std::numeric_limits<uint64_t>::max();
+    uint64_t max_ = 0;
+    int64_t first_ = 0;
+    int64_t last_ = 0;
+
+    // Upper edge of the bucket holding the quantile, clamped to the interval's min / max
+    uint64_t percentile(double quantile) const noexcept
+    {
+        const uint64_t rank = std::clamp<uint64_t>(static_cast<uint64_t>(quantile * static_cast<double>(gaps_) + 0.5), 1,
+                                                   gaps_);
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < LatencyHistogram::BUCKETS; ++i)
+        {
+            seen += counts_[i];
+            if (seen >= rank)
+                return std::clamp(LatencyHistogram::bucketUpperBound(i), min_, max_);
+        }
+        return max_;
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_ARRIVAL_GAPS_H
@@ -0,0 +1,194 @@
+#ifndef MARKET_DATA_SYSTEM_LINE_PUBLISHER_H
+#define MARKET_DATA_SYSTEM_LINE_PUBLISHER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+
+#include <core/async_logger.h>
+#include <core/byte_ring_buffer.h>
+#include <core/metrics_registry.h>
+#include <core/tsc_clock.h>
+#include <network/udp_sender.h>
+
+// Test impairments of one feed line (A/B arbitration tests)
+struct LineImpairment
+{
+    double loss = 0.0;     // Share of datagrams dropped instead of sent, 0..1
+    uint32_t delayUs = 0;  // Every datagram held this long after it was published
+
+    bool any() const { return loss > 0.0 || delayUs > 0; }
+};
+
+/**
+ * @brief One multicast line published from a sender thread of its own.
+ *
+ * publish() copies the already encoded datagram (no re-encoding) behind
+ * its publish time into an SPSC ByteRingBuffer and returns; it never waits.
+ * If the line has fallen RING_BYTES behind the datagram is not taken
+ * (publish() returns false): the caller's line keeps its pace, this one
+ * has a gap, as a real slow line would.
+ *
+ * The line thread sends on its own socket: it takes every datagram that is
+ * due (publish time + delayUs), drops a `loss` share of them (counted as
+ * <line>_lost) and sends the rest with one sendmmsg. A full socket parks
+ * this thread only. Counts <line>_sent, <line>_lost and <line>_errors in a
+ * ThreadMetrics of its own, registered by start().
+ */
+class LinePublisher
+{
+public:
+    static constexpr std::size_t RING_BYTES = 1 << 20;
+
+    LinePublisher(std::string name, const std::string &destIp, uint16_t port, const std::string &interfaceIp,
+                  const LineImpairment &impairment)
+        : name_{std::move(name)}, sender_{destIp, port, interfaceIp}, impairment_{impairment},
+          delayTsc_{TscClock::fromNs(impairment.delayUs * 1e3)}, ring_{std::make_unique<Ring>()}
+    {
+    }
+
+    ~LinePublisher() { stop(); }
+
+    LinePublisher(const LinePublisher &) = delete;
+    LinePublisher &operator=(const LinePublisher &) = delete;
+
+    // --- Publishing thread ---
+
+    // false = the line is RING_BYTES behind, this datagram is not sent on it
+    bool publish(std::span<const uint8_t> datagram) noexcept
+    {
+        std::span<uint8_t> record = ring_->reserve(sizeof(uint64_t) + datagram.size());
+        if (record.empty())
+            return false;
+        const uint64_t publishedTsc = readTsc();
+        std::memcpy(record.data(), &publishedTsc, sizeof(publishedTsc));
+        std::memcpy(record.data() + sizeof(publishedTsc), datagram.data(), datagram.size());
+        ring_->commit(record.size());
+        return true;
+    }
+
+    // --- Setup ---
+
+    // Start the line thread, its counters in `registry` (<name>_sent, <name>_lost, <name>_errors)
+    void start(MetricsRegistry &registry)
+    {
+        metrics_ = &registry.registerThread(name_);
+        sentId_ = registry.counter(name_ + "_sent");
+        lostId_ = registry.counter(name_ + "_lost");
+        errorsId_ = registry.counter(name_ + "_errors");
+        running_.store(true, std::memory_order_relaxed);
+        thread_ = std::thread([this] { run(); });
+    }
+
+    // Sends what is queued (delays still apply), then ends the line thread
+    void stop()
+    {
+        running_.store(false, std::memory_order_relaxed);
+        if (thread_.joinable())
+            thread_.join();
+    }
+
+    const std::string &name() const { return name_; }
+
+private:
+    using Ring = ByteRingBuffer<RING_BYTES>;
+
+    std::string name_;
+    UDPMulticastSender sender_;
+    LineImpairment impairment_;
+    uint64_t delayTsc_;
+    std::unique_ptr<Ring> ring_; // 1 MB, kept off the owner's cache lines
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    ThreadMetrics *metrics_ = nullptr;
+    std::size_t sentId_ = 0;
+    std::size_t lostId_ = 0;
+    std::size_t errorsId_ = 0;
+
+    void run()
+    {
+        std::minstd_rand random{std::random_device{}()};
+        std::bernoulli_distribution lose{impairment_.loss};
+        std::array<std::span<const uint8_t>, UDPMulticastSender::MAX_BATCH> batch;
+        for (;;)
+        {
+            // Everything due, up to one sendmmsg
+            std::size_t count = 0;
+            uint64_t lost = 0;
+            uint64_t dueTsc = 0; // Set when the oldest record is not due yet
+            const uint64_t now = readTsc();
+            while (count < batch.size())
+            {
+                std::span<const uint8_t> record = ring_->peek();
+                if (record.empty())
+                    break;
+                uint64_t publishedTsc;
+                std::memcpy(&publishedTsc, record.data(), sizeof(publishedTsc));
+                if (now - publishedTsc < delayTsc_)
+                {
+                    dueTsc = publishedTsc + delayTsc_;
+                    break;
+                }
+                (void)ring_->read();
+                if (impairment_.loss > 0.0 && lose(random))
+                    ++lost;
+                else
+                    batch[count++] = record.subspan(sizeof(publishedTsc));
+            }
+            if (count > 0)
+                send(std::span(batch.data(), count));
+            if (lost > 0)
+                metrics_->add(lostId_, lost);
+            if (count > 0 || lost > 0)
+            {
+                // Sent or dropped: their bytes go back to the publisher
+                ring_->release();
+                continue;
+            }
+            if (dueTsc != 0)
+            {
+                // Sleep through most of a long wait, spin the last stretch
+                const double waitNs = TscClock::toNs(dueTsc - std::min(dueTsc, readTsc()));
+                if (waitNs > 100e3)
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(static_cast<int64_t>(waitNs - 60e3)));
+                else
+                    cpuRelax();
+                continue;
+            }
+            if (!running_.load(std::memory_order_relaxed))
+                return;
+            std::this_thread::yield();
+        }
+    }
+
+    // The whole batch, parking on a full socket; a hard error drops the rest
+    void send(std::span<const std::span<const uint8_t>> batch) noexcept
+    {
+        std::size_t done = 0;
+        while (done < batch.size())
+        {
+            const BatchResult result = sender_.sendBatch(batch.subspan(done));
+            done += result.sent;
+            if (result.status == SendStatus::Failed)
+            {
+                metrics_->add(errorsId_, batch.size() - done);
+                break;
+            }
+            if (result.status != SendStatus::Sent)
+                sender_.waitWritable(1);
+        }
+        metrics_->add(sentId_, done);
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_LINE_PUBLISHER_H
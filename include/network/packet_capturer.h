@@ -7,7 +7,8 @@
 #include <stdexcept>
 #include <vector>
 #include <pcap/pcap.h> // The main libpcap header
-#include <iostream>
+
+#include <core/async_logger.h>
 
 /**
  * @file PacketCapturer.h
@@ -45,8 +46,10 @@ public:
      * - Creates a handle to a packet capturing session that is almost like an id.
      * - We create the handle, set handle options, create filter, setfilter, and finally
      * encapsulate handle in a unique_ptr for resource management.
+     * - immediate: hand each packet over as it arrives instead of once the
+     * capture buffer fills or the 1 s timeout expires (latency measurements).
      */
-    PacketCapturer(const std::string &device, const std::string &filter)
+    PacketCapturer(const std::string &device, const std::string &filter, bool immediate = false)
     {
         char errbuf[PCAP_ERRBUF_SIZE]; // Error Buffer
 
@@ -61,6 +64,12 @@ public:
         pcap_set_snaplen(handle, 1518);
         pcap_set_promisc(handle, 1);
         pcap_set_timeout(handle, 1000);
+        if (immediate)
+        {
+            pcap_set_immediate_mode(handle, 1);
+        }
+        // Nanosecond capture times where the platform has them (inter-arrival gaps), microseconds otherwise
+        pcap_set_tstamp_precision(handle, PCAP_TSTAMP_PRECISION_NANO);
 
         // Activate the handle
         if (pcap_activate(handle) != 0)
@@ -83,6 +92,7 @@ public:
         }
 
         pcap_freecode(&filterProgram);
+        nanoTimestamps_ = pcap_get_tstamp_precision(handle) == PCAP_TSTAMP_PRECISION_NANO;
 
         // Store handle in unique_ptr with custom deleter
         pcapHandle_.reset(handle);
@@ -97,6 +107,27 @@ public:
         pcap_loop(pcapHandle_.get(), -1, pcapCallback, reinterpret_cast<u_char *>(this));
     }
 
+    /**
+     * @brief Handles what has been captured so far and returns without waiting.
+     *
+     * Switches the handle to non-blocking mode on first use. Returns the
+     * number of packets handled (0 if none were pending, -1 on error).
+     */
+    int dispatch(PacketCallback cb)
+    {
+        if (!nonblocking_)
+        {
+            char errbuf[PCAP_ERRBUF_SIZE];
+            if (pcap_setnonblock(pcapHandle_.get(), 1, errbuf) == -1)
+            {
+                throw std::runtime_error("pcap_setnonblock() failed: " + std::string(errbuf));
+            }
+            nonblocking_ = true;
+        }
+        userCallback_ = std::move(cb);
+        return pcap_dispatch(pcapHandle_.get(), -1, pcapCallback, reinterpret_cast<u_char *>(this));
+    }
+
     /**
      * @brief C++ internal packet handler, called by the pcap_loop C-style trampoline.
      *
@@ -124,17 +155,27 @@ public:
 
         if (header->caplen < totalHeaderLen)
         {
-            std::cerr << "Captured truncated packet." << std::endl;
+            logWarn("Captured truncated packet.");
             return;
         }
 
         size_t payloadSize = header->caplen - totalHeaderLen;
+        packetTimeNs_ = static_cast<int64_t>(header->ts.tv_sec) * 1'000'000'000 +
+                        static_cast<int64_t>(header->ts.tv_usec) * (nanoTimestamps_ ? 1 : 1000);
         if (userCallback_ && payloadSize > 0)
         {
             userCallback_(payload, payloadSize);
         }
     }
 
+    /**
+     * @brief Capture time of the packet being delivered, ns since the epoch.
+     *
+     * Taken by the kernel as the packet passed the capture point, so it is
+     * good for inter-arrival gaps; call it from the callback.
+     */
+    int64_t packetTimeNs() const { return packetTimeNs_; }
+
 private:
     struct PcapDeleter
     {
@@ -149,6 +190,9 @@ private:
 
     std::unique_ptr<pcap_t, PcapDeleter> pcapHandle_;
     PacketCallback userCallback_;
+    bool nonblocking_ = false;
+    bool nanoTimestamps_ = false; // ts.tv_usec holds nanoseconds
+    int64_t packetTimeNs_ = 0;
 };
 
 // Define the C-style callback after the class so PacketCapturer is a complete type
@@ -0,0 +1,289 @@
+#ifndef MARKET_DATA_SYSTEM_PACKET_RING_SENDER_H
+#define MARKET_DATA_SYSTEM_PACKET_RING_SENDER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include <core/async_logger.h>
+#include <network/udp_frame.h>
+#include <network/udp_sender.h> // SendStatus, BatchResult
+
+// --- AF_PACKET (memory-mapped TX ring) ---
+#include <linux/if_packet.h> // For tpacket_req3, tpacket3_hdr, sockaddr_ll
+#include <poll.h>            // For poll()
+#include <sys/mman.h>        // For mmap()
+#include <unistd.h>          // For close()
+
+struct PacketRingOptions
+{
+    unsigned frames = 1024;    // TX ring slots, one datagram each
+    unsigned frameSize = 2048; // Bytes per slot incl. the 48 byte frame header (limits the datagram)
+    bool qdiscBypass = true;   // PACKET_QDISC_BYPASS: straight to the driver, no qdisc (drops instead of queueing)
+};
+
+/**
+ * @brief Raw UDP/IPv4 sender on an AF_PACKET TPACKET_V3 TX ring, no socket layer.
+ *
+ * Finds the interface that owns `interface_ip`, builds the Ethernet, IPv4
+ * and UDP headers once (UdpFrameTemplate) and maps a PACKET_TX_RING.
+ * send() copies the headers and the datagram into the next free frame,
+ * patching only the lengths and the IP checksum. Frames are marked
+ * TP_STATUS_SEND_REQUEST and one send(MSG_DONTWAIT) hands every pending
+ * frame to the device: one system call per sendBatch().
+ *
+ * Statuses follow UDPMulticastSender: no free frame is WouldBlock,
+ * waitWritable() polls for one. A frame the device refuses (ENOBUFS, e.g.
+ * the loopback backlog is full) is lost as with sendto() and only counted
+ * in deviceDrops(), the datagram was already reported Sent; frames after
+ * it stay in the ring for the next flush.
+ *
+ * A same-host receiver needs accept_local on its interface (see
+ * NetInterface::acceptsOwnFrames). Needs CAP_NET_RAW and Linux 4.11+
+ * (TPACKET_V3 TX); the constructor throws otherwise.
+ */
+class PacketRingSender
+{
+public:
+    static constexpr std::size_t MAX_BATCH = 64; // Datagrams per sendBatch() call
+
+    PacketRingSender(const std::string &dest_ip, uint16_t port, const std::string &interface_ip = "127.0.0.1",
+                     const PacketRingOptions &options = {})
+        : device_{NetInterface::owning(parseIpv4(interface_ip))},
+          frameTemplate_{device_, parseIpv4(interface_ip), parseIpv4(dest_ip), port}
+    {
+        fd_ = socket(AF_PACKET, SOCK_RAW, 0); // Protocol 0: transmit only, nothing is queued for reading
+        if (fd_ < 0)
+            throw std::runtime_error(std::format("AF_PACKET socket failed: {}", std::strerror(errno)));
+        try
+        {
+            setupRing(options);
+            if (!device_.acceptsOwnFrames())
+                logWarn("Packet TX ring on loopback: frames are dropped as martians unless "
+                        "net.ipv4.conf.lo.accept_local=1 and net.ipv4.conf.lo.route_localnet=1");
+            logInfo("Packet TX ring on {}: {} frames of {} B, max datagram {} B", device_.name, frames_, frameSize_,
+                    maxDatagram_);
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    ~PacketRingSender()
+    {
+        // Frames still owned by the kernel reference the ring, let them go out first
+        drain(100);
+        release();
+    }
+
+    // Owns a mapping the kernel writes into: neither copied nor moved
+    PacketRingSender(const PacketRingSender &) = delete;
+    PacketRingSender &operator=(const PacketRingSender &) = delete;
+
+    SendStatus send(std::span<const uint8_t> data) noexcept
+    {
+        const SendStatus status = admit(data);
+        if (status != SendStatus::Sent)
+            return status;
+        stage(data);
+        flush();
+        return SendStatus::Sent;
+    }
+
+    // Fills free frames (up to MAX_BATCH), one send() for all
+    BatchResult sendBatch(std::span<const std::span<const uint8_t>> messages) noexcept
+    {
+        const std::size_t count = std::min(messages.size(), MAX_BATCH);
+        std::size_t staged = 0;
+        SendStatus status = SendStatus::Sent;
+        while (staged < count && (status = admit(messages[staged])) == SendStatus::Sent)
+            stage(messages[staged++]);
+        if (staged > 0)
+            flush();
+        return {staged, status};
+    }
+
+    // Park until the next frame is free again (the device has taken it) or timeoutMs passes
+    bool waitWritable(int timeoutMs) noexcept
+    {
+        if (frameFree(head_))
+            return true;
+        flush(); // Frames a failed flush left behind
+        pollfd entry{fd_, POLLOUT, 0};
+        poll(&entry, 1, timeoutMs);
+        return frameFree(head_);
+    }
+
+    // Hand every frame marked for sending to the device (MSG_DONTWAIT: does not wait for them to go out)
+    void flush() noexcept
+    {
+        ++flushCalls_;
+        if (::send(fd_, nullptr, 0, MSG_DONTWAIT) >= 0)
+            return;
+        lastError_ = errno;
+        if (lastError_ == ENOBUFS || lastError_ == EAGAIN)
+        {
+            ++deviceDrops_;
+            return;
+        }
+        logError("Packet TX ring flush failed: {}", std::strerror(lastError_));
+    }
+
+    // Largest UDP payload a frame (and the interface MTU) takes
+    std::size_t maxDatagram() const { return maxDatagram_; }
+    // errno of the last failure (EAGAIN = no free frame)
+    int lastError() const { return lastError_; }
+    // send() system calls made to flush the ring
+    uint64_t flushCalls() const { return flushCalls_; }
+    // Flushes the device refused a frame on (the frame is lost)
+    uint64_t deviceDrops() const { return deviceDrops_; }
+
+private:
+    NetInterface device_;
+    UdpFrameTemplate frameTemplate_; // Headers prebuilt, lengths and IP checksum patched per frame
+
+    int fd_ = -1;
+    uint8_t *ring_ = nullptr;
+    std::size_t ringSize_ = 0;
+    std::size_t frames_ = 0;
+    std::size_t frameSize_ = 0;
+    std::size_t head_ = 0; // Next frame to fill
+    std::size_t maxDatagram_ = 0;
+
+    int lastError_ = 0;
+    uint64_t flushCalls_ = 0;
+    uint64_t deviceDrops_ = 0;
+
+    // Without PACKET_TX_HAS_OFF the frame's data starts right after the aligned tpacket3_hdr
+    static constexpr std::size_t DATA_OFFSET = TPACKET_ALIGN(sizeof(tpacket3_hdr));
+    void setupRing(const PacketRingOptions &options)
+    {
+        int version = TPACKET_V3;
+        if (setsockopt(fd_, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) < 0)
+            throw std::runtime_error(std::format("PACKET_VERSION V3 failed: {}", std::strerror(errno)));
+        // A malformed frame is skipped instead of stopping the ring
+        int loss = 1;
+        setsockopt(fd_, SOL_PACKET, PACKET_LOSS, &loss, sizeof(loss));
+        if (options.qdiscBypass)
+        {
+            int bypass = 1;
+            if (setsockopt(fd_, SOL_PACKET, PACKET_QDISC_BYPASS, &bypass, sizeof(bypass)) < 0)
+                logWarn("PACKET_QDISC_BYPASS unavailable ({}), frames go through the qdisc", std::strerror(errno));
+        }
+
+        // Blocks of whole pages, frames never straddle a block
+        const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        frameSize_ = TPACKET_ALIGN(
+            std::max<std::size_t>(options.frameSize, DATA_OFFSET + UdpFrameTemplate::HEADERS_SIZE + 1));
+        const std::size_t blockSize = (frameSize_ * 32 + page - 1) / page * page;
+        const std::size_t perBlock = blockSize / frameSize_;
+        const std::size_t blocks = (std::max(options.frames, 1u) + perBlock - 1) / perBlock;
+        frames_ = blocks * perBlock;
+
+        tpacket_req3 request{};
+        request.tp_block_size = static_cast<unsigned>(blockSize);
+        request.tp_block_nr = static_cast<unsigned>(blocks);
+        request.tp_frame_size = static_cast<unsigned>(frameSize_);
+        request.tp_frame_nr = static_cast<unsigned>(frames_);
+        if (setsockopt(fd_, SOL_PACKET, PACKET_TX_RING, &request, sizeof(request)) < 0)
+            throw std::runtime_error(std::format("PACKET_TX_RING failed: {}", std::strerror(errno)));
+
+        ringSize_ = blockSize * blocks;
+        void *ring = mmap(nullptr, ringSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, 0);
+        if (ring == MAP_FAILED)
+            throw std::runtime_error(std::format("TX ring mmap failed: {}", std::strerror(errno)));
+        ring_ = static_cast<uint8_t *>(ring);
+
+        sockaddr_ll address{};
+        address.sll_family = AF_PACKET;
+        address.sll_protocol = htons(ETH_P_IP);
+        address.sll_ifindex = device_.index;
+        if (bind(fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+            throw std::runtime_error(std::format("AF_PACKET bind to {} failed: {}", device_.name, std::strerror(errno)));
+
+        // The frame and the device (MTU + Ethernet header) both bound a datagram
+        maxDatagram_ = std::min(frameSize_ - DATA_OFFSET, device_.mtu + sizeof(ether_header)) -
+                       UdpFrameTemplate::HEADERS_SIZE;
+    }
+
+    void release() noexcept
+    {
+        if (ring_)
+            munmap(ring_, ringSize_);
+        if (fd_ >= 0)
+            close(fd_);
+        ring_ = nullptr;
+        fd_ = -1;
+    }
+
+    tpacket3_hdr *frame(std::size_t index) const noexcept
+    {
+        return reinterpret_cast<tpacket3_hdr *>(ring_ + index * frameSize_);
+    }
+
+    // Shared with the kernel: acquire pairs with it handing the frame back
+    bool frameFree(std::size_t index) const noexcept
+    {
+        return std::atomic_ref<uint32_t>(frame(index)->tp_status).load(std::memory_order_acquire) ==
+               TP_STATUS_AVAILABLE;
+    }
+
+    // Sent = the next frame is free and the datagram fits it
+    SendStatus admit(std::span<const uint8_t> data) noexcept
+    {
+        if (data.size() > maxDatagram_)
+        {
+            lastError_ = EMSGSIZE;
+            logError("Packet TX ring send: {} byte datagram exceeds the {} byte maximum", data.size(), maxDatagram_);
+            return SendStatus::Failed;
+        }
+        if (!frameFree(head_))
+        {
+            lastError_ = EAGAIN;
+            return SendStatus::WouldBlock;
+        }
+        return SendStatus::Sent;
+    }
+
+    // Headers + payload into the next frame, then marked for sending
+    void stage(std::span<const uint8_t> data) noexcept
+    {
+        tpacket3_hdr *header = frame(head_);
+        uint8_t *packet = reinterpret_cast<uint8_t *>(header) + DATA_OFFSET;
+        header->tp_len = static_cast<uint32_t>(frameTemplate_.write(packet, data));
+        header->tp_next_offset = 0; // Must be 0 on a V3 TX ring
+        // Release: the frame contents are visible before the kernel sees the request
+        std::atomic_ref<uint32_t>(header->tp_status).store(TP_STATUS_SEND_REQUEST, std::memory_order_release);
+        head_ = head_ + 1 == frames_ ? 0 : head_ + 1;
+    }
+
+    // Flush and wait (up to timeoutMs) until the kernel has handed every frame back
+    void drain(int timeoutMs) noexcept
+    {
+        if (!ring_)
+            return;
+        flush();
+        for (int waited = 0; waited < timeoutMs; ++waited)
+        {
+            bool busy = false;
+            for (std::size_t i = 0; i < frames_ && !busy; ++i)
+                busy = !frameFree(i);
+            if (!busy)
+                return;
+            pollfd entry{fd_, POLLOUT, 0};
+            poll(&entry, 1, 1);
+            flush();
+        }
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_PACKET_RING_SENDER_H
@@ -0,0 +1,146 @@
+#ifndef MARKET_DATA_SYSTEM_SOCKET_CAPTURER_H
+#define MARKET_DATA_SYSTEM_SOCKET_CAPTURER_H
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+#include <core/async_logger.h>
+
+// --- POSIX/BSD Socket Headers ---
+#include <arpa/inet.h>  // For inet_pton()
+#include <net/if.h>     // For if_nametoindex()
+#include <netinet/in.h> // For ip_mreqn, IP_ADD_MEMBERSHIP
+#include <poll.h>       // For poll()
+#include <sys/socket.h> // For recvmsg(), SO_TIMESTAMPNS
+#include <unistd.h>     // For close()
+
+/**
+ * @brief Analyzer source on a plain UDP socket, with the kernel's receive time of every datagram.
+ *
+ * Same callback as PacketCapturer (payload pointer and size). Binds the
+ * port on `groupIp`, joining the group on `device` when it is multicast,
+ * and asks for SO_TIMESTAMPNS: packetTimeNs() is when the datagram reached
+ * the stack (CLOCK_REALTIME), not when this thread got round to it, so
+ * inter-arrival gaps are measured without libpcap. It receives alongside
+ * other sockets on the port (SO_REUSEADDR), taking nothing away from them.
+ */
+class SocketCapturer
+{
+public:
+    using PacketCallback = std::function<void(const uint8_t *, size_t)>;
+
+    SocketCapturer(const std::string &device, const std::string &groupIp, uint16_t port)
+        : sockfd_{socket(AF_INET, SOCK_DGRAM, 0)}
+    {
+        if (sockfd_ < 0)
+            throw std::runtime_error(std::format("socket() failed: {}", std::strerror(errno)));
+        try
+        {
+            setUp(device, groupIp, port);
+        }
+        catch (...)
+        {
+            close(sockfd_);
+            throw;
+        }
+    }
+
+    ~SocketCapturer() { close(sockfd_); }
+
+    SocketCapturer(const SocketCapturer &) = delete;
+    SocketCapturer &operator=(const SocketCapturer &) = delete;
+
+    // Blocking loop, like PacketCapturer::startCapture(), until stop()
+    void startCapture(PacketCallback cb)
+    {
+        running_.store(true, std::memory_order_relaxed);
+        while (running_.load(std::memory_order_relaxed))
+        {
+            pollfd entry{sockfd_, POLLIN, 0};
+            if (poll(&entry, 1, 100) <= 0)
+                continue;
+            // Everything queued, then back to poll()
+            while (receive(cb))
+            {
+            }
+        }
+    }
+
+    void stop() { running_.store(false, std::memory_order_relaxed); }
+
+    // Kernel receive time of the datagram being delivered, ns since the epoch (call from the callback)
+    int64_t packetTimeNs() const { return packetTimeNs_; }
+
+private:
+    int sockfd_;
+    std::atomic<bool> running_{false};
+    int64_t packetTimeNs_ = 0;
+    std::array<uint8_t, 65536> buffer_{};
+
+    void setUp(const std::string &device, const std::string &groupIp, uint16_t port)
+    {
+        int on = 1;
+        setsockopt(sockfd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if (setsockopt(sockfd_, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) < 0)
+            throw std::runtime_error(std::format("SO_TIMESTAMPNS failed: {}", std::strerror(errno)));
+        // A burst arriving while this thread is descheduled still fits
+        int receiveBuffer = 8 * 1024 * 1024;
+        setsockopt(sockfd_, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        if (inet_pton(AF_INET, groupIp.c_str(), &addr.sin_addr) <= 0)
+            throw std::runtime_error("Invalid group IP " + groupIp);
+        if (bind(sockfd_, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0)
+            throw std::runtime_error(std::format("bind {}:{} failed: {}", groupIp, port, std::strerror(errno)));
+
+        if (IN_MULTICAST(ntohl(addr.sin_addr.s_addr)))
+        {
+            ip_mreqn membership{};
+            membership.imr_multiaddr = addr.sin_addr;
+            membership.imr_ifindex = static_cast<int>(if_nametoindex(device.c_str())); // 0 = by route
+            if (setsockopt(sockfd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0)
+                throw std::runtime_error(std::format("Joining {} on {} failed: {}", groupIp, device, std::strerror(errno)));
+        }
+        logInfo("Socket capture on {}:{} ({}), kernel receive timestamps", groupIp, port, device);
+    }
+
+    // One datagram to cb; false once nothing is queued
+    bool receive(const PacketCallback &cb)
+    {
+        iovec iov{buffer_.data(), buffer_.size()};
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(timespec))];
+        msghdr message{};
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        const ssize_t size = recvmsg(sockfd_, &message, MSG_DONTWAIT);
+        if (size < 0)
+            return false;
+
+        packetTimeNs_ = 0;
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(&message, cmsg))
+        {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPNS)
+            {
+                timespec ts;
+                std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                packetTimeNs_ = static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+            }
+        }
+        if (size > 0)
+            cb(buffer_.data(), static_cast<size_t>(size));
+        return true;
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_SOCKET_CAPTURER_H
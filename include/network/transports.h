@@ -0,0 +1,616 @@
+#ifndef MARKET_DATA_SYSTEM_TRANSPORTS_H
+#define MARKET_DATA_SYSTEM_TRANSPORTS_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <core/async_logger.h>
+#include <core/metrics_registry.h>
+#include <core/tsc_clock.h>
+#include <network/line_publisher.h>
+#include <network/packet_ring_sender.h>
+#include <network/tx_timestamps.h>
+#include <network/udp_sender.h>
+#include <network/uring_sender.h>
+#include <network/xdp_socket.h>
+
+/**
+ * @file transports.h
+ * @brief Transport policies for MarketDataEngine.
+ *
+ * send() returns true once the datagram has been handed to the transport,
+ * false if it was dropped (no socket, retry policy gave up, or stopped).
+ * Optional sendBatch(datagrams, running) hands over several at once and
+ * returns how many from the front went out; the rest were dropped.
+ * Optional bindMetrics(registry, metrics) gives a transport the sending
+ * thread's ThreadMetrics for its own counters.
+ */
+
+// How UdpTransport hands datagrams to the kernel
+enum class SendBackend
+{
+    Socket,     // sendto() / sendmmsg(), blocking system call per send (batch)
+    IoUring,    // Queued on an io_uring (UringMulticastSender), completions reaped later
+    PacketRing, // Raw frames on an AF_PACKET TX ring (PacketRingSender), one send() per batch
+    Xdp,        // Raw frames on an AF_XDP socket's TX ring (XdpSender), one kick per batch
+};
+
+/**
+ * @brief What UdpTransport does when the kernel pushes back (NoBuffers / WouldBlock).
+ *
+ * Spin:    retry at once until sent: lowest latency, burns the core meanwhile
+ * Bounded: up to maxRetries retries 1 us apart, then drop
+ * Drop:    drop at once, the sender never stalls
+ * Park:    sleep in poll() until the socket is writable (io_uring: until a
+ *          send completes), then retry. ENOBUFS comes from the device queue,
+ *          which POLLOUT does not track, so it backs off 1 us instead.
+ * Hard errors are never retried. All policies give up once the engine stops.
+ */
+enum class RetryPolicy
+{
+    Spin,
+    Bounded,
+    Drop,
+    Park,
+};
+
+// Where a transport sends to
+struct TransportConfig
+{
+    std::string destIp = "239.255.1.1";
+    uint16_t port = 9999;
+    std::string interfaceIp = "127.0.0.1";
+    SendBackend backend = SendBackend::Socket;
+    UringOptions uring;           // IoUring only
+    PacketRingOptions packetRing; // PacketRing only
+    XdpOptions xdp;               // Xdp only
+    uint16_t gsoSegment = 0;      // Socket only: batches as UDP GSO segments of this size (0 = off)
+    bool txTimestamps = false;    // Socket only, no GSO: send -> software TX timestamp histogram (TxTimestamps)
+    EgressPacing pacing = EgressPacing::Off; // Socket only: the qdisc spaces datagrams (fq / etf on the egress device)
+    double pacingRate = 0;                   // TxTime / Etf: datagrams per second; MaxRate: frame bytes per second
+    std::string lineBIp;          // Second (B) line for A/B arbitration, "" = A only
+    uint16_t lineBPort = 0;       // 0 = port
+    LineImpairment lineA;         // Test impairments: line A goes through a LinePublisher of its own when set
+    LineImpairment lineB;
+    RetryPolicy retry = RetryPolicy::Park;
+    unsigned maxRetries = 100; // Bounded only
+};
+
+// Consumes "--send-backend socket|uring|uring-sqpoll|packet-ring|xdp", "--gso <segment bytes>",
+// "--retry spin|bounded[:N]|drop|park", "--tx-timestamps", "--egress-pacing txtime|etf:<msgs/s>|max-rate:<bytes/s>",
+// "--line-b <ip>[:port]" and "--line-a|b-loss <0..1>" / "--line-a|b-delay-us <us>" from argv (in place, as
+// ThreadPlacement::fromArgs does)
+inline TransportConfig transportConfigFromArgs(int &argc, char **argv, TransportConfig config = {})
+{
+    int kept = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--send-backend" && i + 1 < argc)
+        {
+            std::string_view backend = argv[++i];
+            if (backend == "socket")
+                config.backend = SendBackend::Socket;
+            else if (backend == "uring" || backend == "uring-sqpoll")
+            {
+                config.backend = SendBackend::IoUring;
+                config.uring.sqpoll = backend == "uring-sqpoll";
+            }
+            else if (backend == "packet-ring")
+                config.backend = SendBackend::PacketRing;
+            else if (backend == "xdp")
+                config.backend = SendBackend::Xdp;
+            else
+                throw std::invalid_argument("--send-backend must be socket, uring, uring-sqpoll, packet-ring or xdp");
+        }
+        else if (std::string_view(argv[i]) == "--gso" && i + 1 < argc)
+        {
+            const int segment = std::atoi(argv[++i]);
+            if (segment < 1 || segment > 65507)
+                throw std::invalid_argument("--gso must be a segment size of 1..65507 bytes");
+            config.gsoSegment = static_cast<uint16_t>(segment);
+        }
+        else if (std::string_view(argv[i]) == "--retry" && i + 1 < argc)
+        {
+            std::string_view policy = argv[++i];
+            if (policy == "spin")
+                config.retry = RetryPolicy::Spin;
+            else if (policy == "drop")
+                config.retry = RetryPolicy::Drop;
+            else if (policy == "park")
+                config.retry = RetryPolicy::Park;
+            else if (policy.starts_with("bounded"))
+            {
+                config.retry = RetryPolicy::Bounded;
+                if (policy.size() > 7)
+                {
+                    if (policy[7] != ':' || std::atoi(argv[i] + 8) < 1)
+                        throw std::invalid_argument("--retry bounded:N needs N >= 1");
+                    config.maxRetries = static_cast<unsigned>(std::atoi(argv[i] + 8));
+                }
+            }
+            else
+                throw std::invalid_argument("--retry must be spin, bounded[:N], drop or park");
+        }
+        else if (std::string_view(argv[i]) == "--tx-timestamps")
+        {
+            config.txTimestamps = true;
+        }
+        else if (std::string_view(argv[i]) == "--egress-pacing" && i + 1 < argc)
+        {
+            std::string_view pacing = argv[++i];
+            const std::size_t colon = pacing.find(':');
+            const std::string_view mode = pacing.substr(0, colon);
+            if (mode == "txtime")
+                config.pacing = EgressPacing::TxTime;
+            else if (mode == "etf")
+                config.pacing = EgressPacing::Etf;
+            else if (mode == "max-rate")
+                config.pacing = EgressPacing::MaxRate;
+            else if (mode == "off")
+                config.pacing = EgressPacing::Off;
+            else
+                throw std::invalid_argument("--egress-pacing must be txtime:<msgs/s>, etf:<msgs/s>, max-rate:<bytes/s> or off");
+            config.pacingRate = colon == std::string_view::npos ? 0.0 : std::atof(argv[i] + colon + 1);
+            if (config.pacing != EgressPacing::Off && config.pacingRate <= 0.0)
+                throw std::invalid_argument("--egress-pacing needs a rate > 0, e.g. txtime:100000");
+        }
+        else if (std::string_view(argv[i]) == "--line-b" && i + 1 < argc)
+        {
+            std::string_view line = argv[++i];
+            const std::size_t colon = line.find(':');
+            config.lineBIp = std::string(line.substr(0, colon));
+            if (colon != std::string_view::npos)
+            {
+                const int port = std::atoi(argv[i] + colon + 1);
+                if (port < 1 || port > 65535)
+                    throw std::invalid_argument("--line-b port must be 1..65535");
+                config.lineBPort = static_cast<uint16_t>(port);
+            }
+        }
+        else if ((std::string_view(argv[i]) == "--line-a-loss" || std::string_view(argv[i]) == "--line-b-loss") &&
+                 i + 1 < argc)
+        {
+            LineImpairment &line = argv[i][7] == 'a' ? config.lineA : config.lineB;
+            line.loss = std::atof(argv[++i]);
+            if (line.loss < 0.0 || line.loss > 1.0)
+                throw std::invalid_argument("--line-a|b-loss must be 0..1");
+        }
+        else if ((std::string_view(argv[i]) == "--line-a-delay-us" || std::string_view(argv[i]) == "--line-b-delay-us") &&
+                 i + 1 < argc)
+        {
+            LineImpairment &line = argv[i][7] == 'a' ? config.lineA : config.lineB;
+            const int delay = std::atoi(argv[++i]);
+            if (delay < 0)
+                throw std::invalid_argument("--line-a|b-delay-us must be >= 0");
+            line.delayUs = static_cast<uint32_t>(delay);
+        }
+        else
+        {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+    return config;
+}
+
+/**
+ * @brief UDP multicast, a RetryPolicy decides what happens while the kernel is full.
+ *
+ * The backend is picked at run time from the config: plain socket calls
+ * (optionally UDP GSO for batches), an io_uring, or raw frames on an
+ * AF_PACKET TX ring or an AF_XDP socket (the last three fall back to the
+ * socket, with a warning, where unavailable, e.g. no CAP_NET_RAW). Under
+ * io_uring "full" means every registered slot is in flight, on the TX ring
+ * and AF_XDP every frame is still queued.
+ *
+ * Senders return a SendStatus, nothing on the send path throws. Every
+ * outcome is counted on the sending thread: send_retries, send_enobufs,
+ * send_eagain, send_errors, send_dropped, send_parks. A batch stops at the
+ * first datagram that is not sent; once the policy gives up, it and the
+ * rest of the batch are dropped. A socket that fails to open is reported
+ * once and every send is dropped, so the pipeline still runs (useful
+ * without a multicast route).
+ *
+ * With txTimestamps the socket backend also stamps its datagrams
+ * (TxTimestamps): a reader thread, started by bindMetrics(), records send
+ * call -> leaving the stack, so kernel queueing shows apart from the
+ * sending thread's own send latency.
+ *
+ * With pacing the socket backend leaves the spacing of datagrams to the
+ * kernel (UDPMulticastSender::enablePacing): SCM_TXTIME transmit times or
+ * SO_MAX_PACING_RATE, honoured by fq / etf on the egress device. The
+ * producer can then hand over bursts without spinning; running ahead
+ * parks it in send() on the cut-down send buffer, and txqueue (if on)
+ * includes the time each datagram was held for its slot.
+ *
+ * With lineBIp every datagram is also published on a B line (A/B
+ * arbitration): a LinePublisher copies the encoded bytes and sends them
+ * from a thread and socket of its own, so a slow B line only misses
+ * datagrams (line_b_overrun) and never holds up A. An impaired line A
+ * (loss / delay) is moved onto a LinePublisher the same way. Line threads
+ * start with bindMetrics().
+ */
+class UdpTransport
+{
+public:
+    explicit UdpTransport(const TransportConfig &config)
+        : policy_{config.retry}, maxRetries_{config.maxRetries}
+    {
+        if (!config.lineBIp.empty() || config.lineA.any())
+        {
+            setUpLines(config);
+            if (lineA_)
+                return;
+        }
+        if (config.backend != SendBackend::Socket && config.gsoSegment > 0)
+            logWarn("UDP GSO applies to the socket backend only, these sends are not segmented");
+        if (config.backend != SendBackend::Socket && config.txTimestamps)
+            logWarn("TX timestamps apply to the socket backend only, none are taken");
+        if (config.backend != SendBackend::Socket && config.pacing != EgressPacing::Off)
+            logWarn("Egress pacing applies to the socket backend only, these sends are not paced");
+        if (config.backend == SendBackend::IoUring)
+        {
+            try
+            {
+                uring_ = std::make_unique<UringMulticastSender>(config.destIp, config.port, config.interfaceIp, config.uring);
+                logInfo("io_uring send backend: {} registered slots{}", config.uring.entries,
+                        config.uring.sqpoll ? ", SQPOLL" : "");
+                return;
+            }
+            catch (const std::exception &e)
+            {
+                logWarn("io_uring send backend unavailable ({}), using sendto", e.what());
+            }
+        }
+        if (config.backend == SendBackend::PacketRing)
+        {
+            try
+            {
+                ring_ = std::make_unique<PacketRingSender>(config.destIp, config.port, config.interfaceIp, config.packetRing);
+                return;
+            }
+            catch (const std::exception &e)
+            {
+                logWarn("Packet TX ring send backend unavailable ({}), using sendto", e.what());
+            }
+        }
+        if (config.backend == SendBackend::Xdp)
+        {
+            try
+            {
+                xdp_ = std::make_unique<XdpSender>(config.destIp, config.port, config.interfaceIp, config.xdp);
+                return;
+            }
+            catch (const std::exception &e)
+            {
+                logWarn("AF_XDP send backend unavailable ({}), using sendto", e.what());
+            }
+        }
+        try
+        {
+            sender_ = std::make_unique<UDPMulticastSender>(config.destIp, config.port, config.interfaceIp);
+            if (config.gsoSegment > 0 && sender_->enableGso(config.gsoSegment))
+                logInfo("UDP GSO on: batches sent as {} byte segments", config.gsoSegment);
+            if (config.pacing != EgressPacing::Off && sender_->enablePacing(config.pacing, config.pacingRate))
+            {
+                if (config.pacing == EgressPacing::MaxRate)
+                    logInfo("Egress pacing on: SO_MAX_PACING_RATE {:.0f} bytes/s (needs fq on the egress device)",
+                            config.pacingRate);
+                else
+                    logInfo("Egress pacing on: SCM_TXTIME every {} ns (needs {} on the egress device)",
+                            sender_->txTimeGapNs(), config.pacing == EgressPacing::Etf ? "etf" : "fq");
+            }
+            if (config.txTimestamps)
+                enableTxTimestamps();
+        }
+        catch (const std::exception &e)
+        {
+            logError("Could not initialise network sender: {}", e.what());
+        }
+    }
+
+    // Count every send outcome into the sending thread's metrics (call before sending)
+    void bindMetrics(MetricsRegistry &registry, ThreadMetrics &metrics)
+    {
+        metrics_ = &metrics;
+        retriesId_ = registry.counter("send_retries");
+        noBufsId_ = registry.counter("send_enobufs");
+        wouldBlockId_ = registry.counter("send_eagain");
+        errorsId_ = registry.counter("send_errors");
+        droppedId_ = registry.counter("send_dropped");
+        parksId_ = registry.counter("send_parks");
+        if (timestamps_)
+            timestamps_->start(registry);
+        for (auto [line, overrunId] : {std::pair{lineA_.get(), &lineAOverrunId_}, std::pair{lineB_.get(), &lineBOverrunId_}})
+        {
+            if (!line)
+                continue;
+            *overrunId = registry.counter(line->name() + "_overrun");
+            line->start(registry);
+        }
+    }
+
+    bool send(std::span<const uint8_t> datagram, const std::atomic<bool> &running) noexcept
+    {
+        const bool sent = lineA_ ? publish(*lineA_, lineAOverrunId_, datagram) : sendPrimary(datagram, running);
+        if (lineB_)
+            publish(*lineB_, lineBOverrunId_, datagram);
+        return sent;
+    }
+
+    // One sendmmsg() (io_uring submit, TX ring flush, AF_XDP kick) per MAX_BATCH datagrams, pushed-back rest handled as send() does
+    std::size_t sendBatch(std::span<const std::span<const uint8_t>> datagrams, const std::atomic<bool> &running) noexcept
+    {
+        std::size_t sent = 0;
+        if (lineA_)
+        {
+            while (sent < datagrams.size() && publish(*lineA_, lineAOverrunId_, datagrams[sent]))
+                ++sent;
+        }
+        else
+        {
+            sent = sendBatchPrimary(datagrams, running);
+        }
+        // Line B gets every datagram, whatever line A did with it
+        if (lineB_)
+        {
+            for (std::span<const uint8_t> datagram : datagrams)
+                publish(*lineB_, lineBOverrunId_, datagram);
+        }
+        return sent;
+    }
+
+    RetryPolicy retryPolicy() const { return policy_; }
+
+    static constexpr const char *name() { return "UDP"; }
+
+private:
+    std::unique_ptr<UDPMulticastSender> sender_; // One of the four is set (none while line A is a LinePublisher)
+    std::unique_ptr<UringMulticastSender> uring_;
+    std::unique_ptr<PacketRingSender> ring_;
+    std::unique_ptr<XdpSender> xdp_;
+    std::unique_ptr<TxTimestamps> timestamps_; // sender_ only; declared after it, so its reader stops first
+    std::unique_ptr<LinePublisher> lineA_;     // Set only for an impaired line A
+    std::unique_ptr<LinePublisher> lineB_;
+    RetryPolicy policy_;
+    unsigned maxRetries_;
+    ThreadMetrics *metrics_ = nullptr;
+    std::size_t retriesId_ = 0;
+    std::size_t noBufsId_ = 0;
+    std::size_t wouldBlockId_ = 0;
+    std::size_t errorsId_ = 0;
+    std::size_t droppedId_ = 0;
+    std::size_t parksId_ = 0;
+    std::size_t lineAOverrunId_ = 0;
+    std::size_t lineBOverrunId_ = 0;
+
+    void setUpLines(const TransportConfig &config)
+    {
+        if (config.lineA.any())
+        {
+            lineA_ = std::make_unique<LinePublisher>("line_a", config.destIp, config.port, config.interfaceIp, config.lineA);
+            logInfo("Line A {}:{} from its own thread: loss {:.2f}%, delay {} us", config.destIp, config.port,
+                    config.lineA.loss * 100, config.lineA.delayUs);
+        }
+        if (!config.lineBIp.empty())
+        {
+            const uint16_t port = config.lineBPort ? config.lineBPort : config.port;
+            lineB_ = std::make_unique<LinePublisher>("line_b", config.lineBIp, port, config.interfaceIp, config.lineB);
+            logInfo("Line B {}:{} from its own thread: loss {:.2f}%, delay {} us", config.lineBIp, port,
+                    config.lineB.loss * 100, config.lineB.delayUs);
+        }
+        else if (config.lineB.any())
+        {
+            logWarn("Line B impairments given without --line-b, ignored");
+        }
+    }
+
+    // A line's copy of the datagram; a line that is too far behind misses it (counted on this thread)
+    bool publish(LinePublisher &line, std::size_t overrunId, std::span<const uint8_t> datagram) noexcept
+    {
+        if (line.publish(datagram))
+            return true;
+        count(overrunId);
+        return false;
+    }
+
+    bool sendPrimary(std::span<const uint8_t> datagram, const std::atomic<bool> &running) noexcept
+    {
+        if (uring_)
+            return sendWith(*uring_, datagram, running);
+        if (ring_)
+            return sendWith(*ring_, datagram, running);
+        if (xdp_)
+            return sendWith(*xdp_, datagram, running);
+        if (sender_)
+            return sendWith(*sender_, datagram, running);
+        return false;
+    }
+
+    std::size_t sendBatchPrimary(std::span<const std::span<const uint8_t>> datagrams, const std::atomic<bool> &running) noexcept
+    {
+        if (uring_)
+            return sendBatchWith(*uring_, datagrams, running);
+        if (ring_)
+            return sendBatchWith(*ring_, datagrams, running);
+        if (xdp_)
+            return sendBatchWith(*xdp_, datagrams, running);
+        if (sender_)
+            return sendBatchWith(*sender_, datagrams, running);
+        return 0;
+    }
+
+    void count(std::size_t counter, uint64_t n = 1) noexcept
+    {
+        if (metrics_)
+            metrics_->add(counter, n);
+    }
+
+    // GSO numbers a whole batch as one datagram, so the stamps could not be matched
+    void enableTxTimestamps()
+    {
+        if (sender_->gsoSegment() > 0)
+        {
+            logWarn("TX timestamps are not taken with UDP GSO on");
+            return;
+        }
+        try
+        {
+            timestamps_ = std::make_unique<TxTimestamps>(sender_->fd());
+            logInfo("TX timestamps on: send -> software TX stamp recorded as {}", TX_QUEUE_LATENCY_NAME);
+        }
+        catch (const std::exception &e)
+        {
+            logWarn("TX timestamps unavailable: {}", e.what());
+        }
+    }
+
+    // TX timestamps: send time of the datagrams about to go out, then how many did (socket only)
+    template <typename Sender>
+    void stampSends(std::size_t count) noexcept
+    {
+        if constexpr (std::is_same_v<Sender, UDPMulticastSender>)
+        {
+            if (timestamps_)
+                timestamps_->stamp(count);
+        }
+    }
+
+    template <typename Sender>
+    void countSent(std::size_t count) noexcept
+    {
+        if constexpr (std::is_same_v<Sender, UDPMulticastSender>)
+        {
+            if (timestamps_)
+                timestamps_->sent(count);
+        }
+    }
+
+    template <typename Sender>
+    bool sendWith(Sender &sender, std::span<const uint8_t> datagram, const std::atomic<bool> &running) noexcept
+    {
+        for (unsigned attempt = 0;; ++attempt)
+        {
+            stampSends<Sender>(1);
+            const SendStatus status = sender.send(datagram);
+            if (status == SendStatus::Sent)
+            {
+                countSent<Sender>(1);
+                return true;
+            }
+            if (!retry(sender, status, attempt, running))
+            {
+                count(droppedId_);
+                return false;
+            }
+        }
+    }
+
+    template <typename Sender>
+    std::size_t sendBatchWith(Sender &sender, std::span<const std::span<const uint8_t>> datagrams,
+                              const std::atomic<bool> &running) noexcept
+    {
+        std::size_t done = 0;
+        unsigned attempt = 0;
+        while (done < datagrams.size())
+        {
+            stampSends<Sender>(std::min(datagrams.size() - done, Sender::MAX_BATCH));
+            const BatchResult result = sender.sendBatch(datagrams.subspan(done));
+            countSent<Sender>(result.sent);
+            done += result.sent;
+            if (result.status == SendStatus::Sent)
+                continue;
+            // The retry budget is per datagram: progress starts it over
+            if (result.sent > 0)
+                attempt = 0;
+            if (!retry(sender, result.status, attempt++, running))
+            {
+                count(droppedId_, datagrams.size() - done);
+                return done;
+            }
+        }
+        return done;
+    }
+
+    // Count the outcome, then apply the policy. true = try the same datagram again.
+    template <typename Sender>
+    bool retry(Sender &sender, SendStatus status, unsigned attempt, const std::atomic<bool> &running) noexcept
+    {
+        switch (status)
+        {
+        case SendStatus::NoBuffers:
+            count(noBufsId_);
+            break;
+        case SendStatus::WouldBlock:
+            count(wouldBlockId_);
+            break;
+        default:
+            count(errorsId_);
+            return false;
+        }
+        if (policy_ == RetryPolicy::Drop || !running.load(std::memory_order_relaxed) ||
+            (policy_ == RetryPolicy::Bounded && attempt >= maxRetries_))
+            return false;
+
+        count(retriesId_);
+        switch (policy_)
+        {
+        case RetryPolicy::Spin:
+            cpuRelax();
+            break;
+        case RetryPolicy::Park:
+            if (status == SendStatus::WouldBlock)
+            {
+                // Bounded wait so a stop is noticed
+                count(parksId_);
+                sender.waitWritable(1);
+                break;
+            }
+            [[fallthrough]];
+        default:
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            break;
+        }
+        return true;
+    }
+};
+
+// Discards every datagram (measures the pipeline without the kernel)
+class NullTransport
+{
+public:
+    explicit NullTransport(const TransportConfig &) {}
+
+    bool send(std::span<const uint8_t> datagram, const std::atomic<bool> &) noexcept
+    {
+        bytes_ += datagram.size();
+        return true;
+    }
+
+    std::size_t sendBatch(std::span<const std::span<const uint8_t>> datagrams, const std::atomic<bool> &) noexcept
+    {
+        for (auto datagram : datagrams)
+            bytes_ += datagram.size();
+        return datagrams.size();
+    }
+
+    uint64_t bytes() const { return bytes_; }
+
+    static constexpr const char *name() { return "Null"; }
+
+private:
+    uint64_t bytes_ = 0;
+};
+
+#endif // MARKET_DATA_SYSTEM_TRANSPORTS_H
@@ -0,0 +1,191 @@
+#ifndef MARKET_DATA_SYSTEM_TX_TIMESTAMPS_H
+#define MARKET_DATA_SYSTEM_TX_TIMESTAMPS_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <format>
+#include <stdexcept>
+#include <thread>
+
+#include <core/async_logger.h>
+#include <core/metrics_registry.h>
+#include <core/tsc_clock.h>
+
+// --- Socket error queue (SO_TIMESTAMPING) ---
+#include <linux/errqueue.h>   // For sock_extended_err, scm_timestamping, SO_EE_ORIGIN_TIMESTAMPING
+#include <linux/net_tstamp.h> // For SOF_TIMESTAMPING_*
+#include <netinet/in.h>       // For IP_RECVERR
+#include <poll.h>             // For poll()
+#include <sys/socket.h>       // For recvmsg(), MSG_ERRQUEUE
+
+// Histogram the timestamp reader records into: send call -> software TX timestamp
+inline constexpr const char *TX_QUEUE_LATENCY_NAME = "latency.txqueue";
+
+/**
+ * @brief Software TX timestamps of a UDP socket, matched to the sends that caused them.
+ *
+ * Enables SO_TIMESTAMPING with TX_SOFTWARE | OPT_ID | OPT_TSONLY: the
+ * kernel stamps every datagram as the driver takes it and queues the stamp
+ * on the socket's error queue, numbered with a per-socket counter (OPT_ID)
+ * that counts the datagrams sent so far - the sequence number each send is
+ * matched by. A failed send returns its number (Linux 6.2+), so the
+ * counter stays equal to the datagrams that went out.
+ *
+ * The sending thread only writes the send time of the datagrams it is about
+ * to send into a window (stamp() before the call, sent() after it). A
+ * reader thread of its own (start()) drains the error queue, matches each
+ * stamp to its send time and records the difference into
+ * TX_QUEUE_LATENCY_NAME of its own ThreadMetrics: time spent in the stack,
+ * qdisc and device queue, which the sending thread's own send latency does
+ * not show once the call has returned. A stamp read after the sender has
+ * run more than WINDOW datagrams ahead no longer matches and is counted as
+ * tx_timestamps_unmatched; stamps that overflow the error queue are
+ * dropped by the kernel (the histogram count falls short of ticks sent).
+ */
+class TxTimestamps
+{
+public:
+    static constexpr std::size_t WINDOW = 8192; // Sends awaiting their stamp, a power of two
+
+    // Turns timestamping on for `fd`; throws if the kernel refuses
+    explicit TxTimestamps(int fd) : fd_{fd}
+    {
+        int flags = SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_OPT_ID |
+                    SOF_TIMESTAMPING_OPT_TSONLY;
+        if (setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) < 0)
+            throw std::runtime_error(std::format("SO_TIMESTAMPING failed: {}", std::strerror(errno)));
+        // Queued stamps count against the receive buffer: room for a burst the reader has not caught up with
+        int receiveBuffer = 8 * 1024 * 1024;
+        setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    }
+
+    ~TxTimestamps() { stop(); }
+
+    TxTimestamps(const TxTimestamps &) = delete;
+    TxTimestamps &operator=(const TxTimestamps &) = delete;
+
+    // --- Sending thread ---
+
+    // Right before the send call: the next `count` datagrams leave now
+    void stamp(std::size_t count) noexcept
+    {
+        const int64_t now = realtimeNs();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Slot &slot = window_[(next_ + i) & (WINDOW - 1)];
+            slot.sendNs.store(now, std::memory_order_relaxed);
+            slot.key.store(next_ + i + 1, std::memory_order_release);
+        }
+    }
+
+    // After it: the first `count` of them were sent (and numbered by the kernel)
+    void sent(std::size_t count) noexcept { next_ += count; }
+
+    // --- Setup ---
+
+    // Start the reader thread, its histogram and counters in `registry`
+    void start(MetricsRegistry &registry)
+    {
+        metrics_ = &registry.registerThread("tx-timestamps");
+        latencyId_ = registry.histogram(TX_QUEUE_LATENCY_NAME);
+        unmatchedId_ = registry.counter("tx_timestamps_unmatched");
+        running_.store(true, std::memory_order_relaxed);
+        reader_ = std::thread([this] { readLoop(); });
+    }
+
+    void stop()
+    {
+        running_.store(false, std::memory_order_relaxed);
+        if (reader_.joinable())
+            reader_.join();
+    }
+
+private:
+    // One send awaiting its stamp: written by the sender, read by the reader
+    struct Slot
+    {
+        std::atomic<uint64_t> key{0}; // Datagram number + 1 (0 = never used)
+        std::atomic<int64_t> sendNs{0};
+    };
+
+    int fd_;
+    uint64_t next_ = 0; // Sending thread: number of the next datagram
+    std::array<Slot, WINDOW> window_{};
+
+    std::thread reader_;
+    std::atomic<bool> running_{false};
+    ThreadMetrics *metrics_ = nullptr;
+    std::size_t latencyId_ = 0;
+    std::size_t unmatchedId_ = 0;
+    uint64_t lastKey_ = 0; // Reader: widens the kernel's 32-bit numbers
+
+    // The clock software TX stamps are taken with
+    static int64_t realtimeNs() noexcept
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_REALTIME, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+    }
+
+    void readLoop()
+    {
+        while (running_.load(std::memory_order_relaxed))
+        {
+            // A pending error queue shows as POLLERR, whatever was asked for
+            pollfd entry{fd_, 0, 0};
+            if (poll(&entry, 1, 100) > 0 && (entry.revents & POLLERR))
+                drain();
+        }
+        drain();
+    }
+
+    void drain() noexcept
+    {
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(scm_timestamping)) + CMSG_SPACE(sizeof(sock_extended_err) +
+                                                                                       sizeof(sockaddr_in))];
+        for (;;)
+        {
+            msghdr message{};
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+            if (recvmsg(fd_, &message, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+                return;
+
+            const scm_timestamping *stamp = nullptr;
+            const sock_extended_err *error = nullptr;
+            for (cmsghdr *cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(&message, cmsg))
+            {
+                if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPING)
+                    stamp = reinterpret_cast<const scm_timestamping *>(CMSG_DATA(cmsg));
+                else if (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR)
+                    error = reinterpret_cast<const sock_extended_err *>(CMSG_DATA(cmsg));
+            }
+            if (stamp && error && error->ee_errno == ENOMSG && error->ee_origin == SO_EE_ORIGIN_TIMESTAMPING)
+                match(error->ee_data, stamp->ts[0]);
+        }
+    }
+
+    void match(uint32_t kernelKey, const timespec &sentAt) noexcept
+    {
+        // Nearest 64-bit number with these low 32 bits
+        const uint64_t key = lastKey_ + static_cast<int32_t>(kernelKey - static_cast<uint32_t>(lastKey_));
+        lastKey_ = key;
+        const Slot &slot = window_[key & (WINDOW - 1)];
+        if (slot.key.load(std::memory_order_acquire) != key + 1)
+        {
+            metrics_->add(unmatchedId_);
+            return;
+        }
+        const int64_t stampNs = static_cast<int64_t>(sentAt.tv_sec) * 1'000'000'000 + sentAt.tv_nsec;
+        const int64_t queuedNs = stampNs - slot.sendNs.load(std::memory_order_relaxed);
+        metrics_->histogram(latencyId_).record(TscClock::fromNs(static_cast<double>(std::max<int64_t>(queuedNs, 0))));
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_TX_TIMESTAMPS_H
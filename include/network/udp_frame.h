@@ -0,0 +1,233 @@
+#ifndef MARKET_DATA_SYSTEM_UDP_FRAME_H
+#define MARKET_DATA_SYSTEM_UDP_FRAME_H
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+// --- Interfaces and raw Ethernet / IPv4 / UDP headers ---
+#include <arpa/inet.h>    // For inet_pton(), htons()
+#include <ifaddrs.h>      // For getifaddrs()
+#include <net/ethernet.h> // For ether_header, ETH_P_IP
+#include <net/if.h>       // For ifreq, IFF_LOOPBACK
+#include <netinet/ip.h>   // For iphdr
+#include <netinet/udp.h>  // For udphdr
+#include <sys/ioctl.h>    // For SIOCGIFINDEX, SIOCGIFHWADDR, SIOCGIFMTU
+#include <unistd.h>       // For close()
+
+/**
+ * @file udp_frame.h
+ * @brief What raw-frame senders and receivers (AF_PACKET, AF_XDP) need
+ * instead of the socket layer: the interface behind an IP, and UDP/IPv4
+ * frames built from a template.
+ */
+
+inline in_addr parseIpv4(const std::string &ip)
+{
+    in_addr address{};
+    if (inet_pton(AF_INET, ip.c_str(), &address) <= 0)
+        throw std::runtime_error(std::format("Invalid IP address {}", ip));
+    return address;
+}
+
+// The local interface that owns an IPv4 address
+struct NetInterface
+{
+    std::string name;
+    int index = 0;
+    bool loopback = false;
+    std::size_t mtu = 0;
+    std::array<uint8_t, 6> mac{};
+
+    // Throws if no interface has the address
+    static NetInterface owning(in_addr address)
+    {
+        NetInterface device;
+        ifaddrs *list = nullptr;
+        if (getifaddrs(&list) < 0)
+            throw std::runtime_error(std::format("getifaddrs failed: {}", std::strerror(errno)));
+        for (ifaddrs *entry = list; entry; entry = entry->ifa_next)
+        {
+            if (entry->ifa_addr && entry->ifa_addr->sa_family == AF_INET &&
+                reinterpret_cast<sockaddr_in *>(entry->ifa_addr)->sin_addr.s_addr == address.s_addr)
+            {
+                device.name = entry->ifa_name;
+                device.loopback = entry->ifa_flags & IFF_LOOPBACK;
+                break;
+            }
+        }
+        freeifaddrs(list);
+        if (device.name.empty())
+            throw std::runtime_error("No interface owns the interface IP");
+
+        // Any socket answers interface ioctls
+        const int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0)
+            throw std::runtime_error(std::format("socket failed: {}", std::strerror(errno)));
+        ifreq request{};
+        std::strncpy(request.ifr_name, device.name.c_str(), IFNAMSIZ - 1);
+        const char *failed = nullptr;
+        if (ioctl(fd, SIOCGIFINDEX, &request) < 0)
+            failed = "SIOCGIFINDEX";
+        device.index = request.ifr_ifindex;
+        if (!failed && ioctl(fd, SIOCGIFMTU, &request) < 0)
+            failed = "SIOCGIFMTU";
+        device.mtu = static_cast<std::size_t>(request.ifr_mtu);
+        if (!failed && ioctl(fd, SIOCGIFHWADDR, &request) < 0)
+            failed = "SIOCGIFHWADDR";
+        std::memcpy(device.mac.data(), request.ifr_hwaddr.sa_data, device.mac.size());
+        const int error = errno;
+        close(fd);
+        if (failed)
+            throw std::runtime_error(std::format("{} {} failed: {}", failed, device.name, std::strerror(error)));
+        return device;
+    }
+
+    /**
+     * Frames injected below the IP layer carry no route, so the receive path
+     * validates them like foreign traffic and drops (as martians) those whose
+     * source is a local address unless accept_local is set on the receiving
+     * interface; loopback also needs route_localnet. Only the sending side
+     * is known here, so this answers for loopback (sender = receiver).
+     */
+    bool acceptsOwnFrames() const
+    {
+        return !loopback || (sysctlOn("/proc/sys/net/ipv4/conf/lo/accept_local") &&
+                             sysctlOn("/proc/sys/net/ipv4/conf/lo/route_localnet"));
+    }
+
+private:
+    static bool sysctlOn(const char *path)
+    {
+        char value = '0';
+        if (FILE *file = std::fopen(path, "r"))
+        {
+            value = static_cast<char>(std::fgetc(file));
+            std::fclose(file);
+        }
+        return value == '1';
+    }
+};
+
+/**
+ * @brief Ethernet + IPv4 + UDP headers built once, copied in front of every payload.
+ *
+ * Source MAC of the sending interface; destination MAC from the group for
+ * multicast, all zero on loopback, broadcast otherwise (there is no ARP).
+ * write() patches only the IP / UDP lengths and the IP header checksum,
+ * incrementally over the sum of the fixed fields; the UDP checksum is left
+ * 0 (optional for IPv4). Source port = destination port, TTL 1 for
+ * multicast (the socket default) and 64 otherwise.
+ */
+class UdpFrameTemplate
+{
+public:
+    static constexpr std::size_t IP_OFFSET = sizeof(ether_header);
+    static constexpr std::size_t UDP_OFFSET = IP_OFFSET + sizeof(iphdr);
+    // Ethernet + IPv4 + UDP, 42 bytes in front of every datagram
+    static constexpr std::size_t HEADERS_SIZE = UDP_OFFSET + sizeof(udphdr);
+
+    UdpFrameTemplate(const NetInterface &device, in_addr source, in_addr dest, uint16_t port)
+    {
+        const auto destBytes = reinterpret_cast<const uint8_t *>(&dest.s_addr);
+        const bool multicast = (destBytes[0] & 0xF0) == 0xE0;
+
+        ether_header ethernet{};
+        if (multicast)
+        {
+            // 01:00:5e + the low 23 bits of the group
+            const uint8_t mac[6] = {0x01, 0x00, 0x5e, static_cast<uint8_t>(destBytes[1] & 0x7F), destBytes[2],
+                                    destBytes[3]};
+            std::memcpy(ethernet.ether_dhost, mac, 6);
+        }
+        else if (!device.loopback)
+        {
+            std::memset(ethernet.ether_dhost, 0xFF, 6);
+        }
+        std::memcpy(ethernet.ether_shost, device.mac.data(), 6);
+        ethernet.ether_type = htons(ETH_P_IP);
+
+        iphdr ip{};
+        ip.version = 4;
+        ip.ihl = sizeof(iphdr) / 4;
+        ip.frag_off = htons(IP_DF);
+        ip.ttl = multicast ? 1 : 64;
+        ip.protocol = IPPROTO_UDP;
+        ip.saddr = source.s_addr;
+        ip.daddr = dest.s_addr;
+
+        udphdr udp{};
+        udp.source = htons(port);
+        udp.dest = htons(port);
+
+        std::memcpy(headers_.data(), &ethernet, sizeof(ethernet));
+        std::memcpy(headers_.data() + IP_OFFSET, &ip, sizeof(ip));
+        std::memcpy(headers_.data() + UDP_OFFSET, &udp, sizeof(udp));
+
+        // Byte order does not matter to a one's complement sum as long as it is stored the same way
+        for (std::size_t i = 0; i < sizeof(iphdr); i += 2)
+        {
+            uint16_t word;
+            std::memcpy(&word, headers_.data() + IP_OFFSET + i, sizeof(word));
+            ipSum_ += word;
+        }
+    }
+
+    // Headers + payload at `frame`, returns the frame length
+    std::size_t write(uint8_t *frame, std::span<const uint8_t> payload) const noexcept
+    {
+        std::memcpy(frame, headers_.data(), HEADERS_SIZE);
+        std::memcpy(frame + HEADERS_SIZE, payload.data(), payload.size());
+
+        const uint16_t ipLength = htons(static_cast<uint16_t>(sizeof(iphdr) + sizeof(udphdr) + payload.size()));
+        const uint16_t udpLength = htons(static_cast<uint16_t>(sizeof(udphdr) + payload.size()));
+        uint32_t sum = ipSum_ + ipLength;
+        sum = (sum & 0xFFFF) + (sum >> 16);
+        sum = (sum & 0xFFFF) + (sum >> 16);
+        const auto checksum = static_cast<uint16_t>(~sum);
+        std::memcpy(frame + IP_OFFSET + offsetof(iphdr, tot_len), &ipLength, sizeof(ipLength));
+        std::memcpy(frame + IP_OFFSET + offsetof(iphdr, check), &checksum, sizeof(checksum));
+        std::memcpy(frame + UDP_OFFSET + offsetof(udphdr, len), &udpLength, sizeof(udpLength));
+        return HEADERS_SIZE + payload.size();
+    }
+
+private:
+    std::array<uint8_t, HEADERS_SIZE> headers_{};
+    uint32_t ipSum_ = 0; // One's complement sum of the IP header with length and checksum 0
+};
+
+/**
+ * @brief The UDP payload of an Ethernet frame, empty unless it is IPv4 / UDP
+ * to `port` (0 = any port) and not truncated.
+ */
+inline std::span<const uint8_t> udpPayload(std::span<const uint8_t> frame, uint16_t port = 0) noexcept
+{
+    if (frame.size() < UdpFrameTemplate::HEADERS_SIZE)
+        return {};
+    ether_header ethernet;
+    std::memcpy(&ethernet, frame.data(), sizeof(ethernet));
+    const uint8_t *ip = frame.data() + sizeof(ether_header);
+    const std::size_t ipHeaderLength = (ip[0] & 0x0F) * 4;
+    if (ethernet.ether_type != htons(ETH_P_IP) || ip[9] != IPPROTO_UDP ||
+        frame.size() < sizeof(ether_header) + ipHeaderLength + sizeof(udphdr))
+        return {};
+
+    udphdr udp;
+    std::memcpy(&udp, ip + ipHeaderLength, sizeof(udp));
+    if (port != 0 && udp.dest != htons(port))
+        return {};
+    const std::size_t offset = sizeof(ether_header) + ipHeaderLength + sizeof(udphdr);
+    // The UDP length, not the frame, says where the payload ends (Ethernet pads short frames)
+    const std::size_t length = std::min<std::size_t>(frame.size() - offset, ntohs(udp.len) - sizeof(udphdr));
+    return frame.subspan(offset, length);
+}
+
+#endif // MARKET_DATA_SYSTEM_UDP_FRAME_H
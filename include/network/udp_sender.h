@@ -4,16 +4,59 @@
 #include <string>
 #include <stdexcept>
 #include <span>
-#include <iostream>
+#include <array>
+#include <vector>
+#include <algorithm>
 #include <cstring>
 #include <cerrno>
+#include <ctime>
+
+#include <core/async_logger.h>
 
 // --- POSIX/BSD Socket Headers ---
-#include <sys/socket.h> // For socket(), sendto()
+#include <sys/socket.h> // For socket(), sendto(), sendmmsg()
+#include <sys/uio.h>    // For iovec
+#include <netinet/udp.h> // For UDP_SEGMENT
+#include <linux/net_tstamp.h> // For sock_txtime (SO_TXTIME)
 #include <arpa/inet.h>  // For sockaddr_in, inet_pton()
+#include <poll.h>       // For poll()
 #include <unistd.h>     // For close()
 #include <cstring>      // For memset()
 
+// Outcome of a send: no exceptions on the hot path, the caller picks a retry policy
+enum class SendStatus : uint8_t
+{
+    Sent,
+    NoBuffers,  // ENOBUFS: device / qdisc queue full, retry later
+    WouldBlock, // EAGAIN: socket send buffer full (io_uring: every slot in flight), retry later
+    Failed,     // Hard error (logged), the datagram is dropped
+};
+
+// sendBatch(): datagrams sent from the front, and why it stopped (Sent = no error, call again for any rest)
+struct BatchResult
+{
+    std::size_t sent;
+    SendStatus status;
+};
+
+// Kernel egress pacing of a socket: the qdisc spaces the datagrams, not the sending thread
+enum class EgressPacing : uint8_t
+{
+    Off,
+    TxTime,  // SCM_TXTIME on every datagram, CLOCK_MONOTONIC (fq qdisc)
+    Etf,     // SCM_TXTIME, CLOCK_TAI, scheduled a lead ahead (etf qdisc, which drops late datagrams)
+    MaxRate, // SO_MAX_PACING_RATE on the socket (fq qdisc)
+};
+
+inline SendStatus sendStatusFromErrno(int error) noexcept
+{
+    if (error == ENOBUFS)
+        return SendStatus::NoBuffers;
+    if (error == EAGAIN || error == EWOULDBLOCK)
+        return SendStatus::WouldBlock;
+    return SendStatus::Failed;
+}
+
 /*
  * Wrapper around c-style networking    threads
  * Ensures RAII principles
@@ -47,8 +90,7 @@ public:
         int sendBufferSize = 4 * 1024 * 1024;
         if (setsockopt(sockfd_, SOL_SOCKET, SO_SNDBUF, &sendBufferSize, sizeof(sendBufferSize)) < 0)
         {
-            std::cerr << "Warning: Could not increase socket buffer size. "
-                      << "You might see packet drops under load." << std::endl;
+            logWarn("Warning: Could not increase socket buffer size. You might see packet drops under load.");
         }
 
         // new change (interface mapping)
@@ -78,8 +120,11 @@ public:
         }
     }
 
-    void send(std::span<const uint8_t> data)
+    SendStatus send(std::span<const uint8_t> data) noexcept
     {
+        if (txTimeGapNs_ > 0)
+            return sendTimed(data);
+
         ssize_t bytesSent = sendto(sockfd_,
                                    data.data(), // Pointer to data
                                    data.size(), // Size of data
@@ -90,26 +135,200 @@ public:
         // Error handling
         if (bytesSent < 0)
         {
-            // Check specifically for "Buffer Full" errors (ENOBUFS)
-            if (errno == ENOBUFS || errno == EAGAIN || errno == EWOULDBLOCK)
-            {
-                // THROW exception so the caller can catch it and retry!
-                throw std::runtime_error("ENOBUFS");
-            }
-            else
+            // "Buffer full" (ENOBUFS / EAGAIN) goes back to the caller to retry
+            lastError_ = errno;
+            const SendStatus status = sendStatusFromErrno(lastError_);
+            if (status == SendStatus::Failed)
             {
                 // Hard error (bad network, bad address, etc.) - Just print
-                std::cerr << "sendto failed: " << std::strerror(errno) << std::endl;
+                logError("sendto failed: {}", std::strerror(lastError_));
             }
+            return status;
         }
         // Partial packet send
-        else if (bytesSent != static_cast<ssize_t>(data.size()))
+        if (bytesSent != static_cast<ssize_t>(data.size()))
+        {
+            logWarn("Partial packet sent. Sent {} but expected {}", bytesSent, data.size());
+        }
+        return SendStatus::Sent;
+    }
+
+    // Park until the socket buffer has room (POLLOUT) or timeoutMs passes. false = timed out.
+    bool waitWritable(int timeoutMs) noexcept
+    {
+        pollfd entry{sockfd_, POLLOUT, 0};
+        return poll(&entry, 1, timeoutMs) > 0;
+    }
+
+    static constexpr std::size_t MAX_BATCH = 64; // Datagrams per sendBatch() call
+
+    /**
+     * @brief Send up to MAX_BATCH datagrams with one sendmmsg() system call.
+     *
+     * The mmsghdr / iovec arrays are members, refilled per call (no
+     * allocation). The kernel may take only part of the batch; the rest is
+     * resubmitted until everything is sent or the socket buffer fills.
+     * With GSO on (enableGso) the batch goes out as one segmented sendmsg().
+     *
+     * @return Datagrams sent from the front of `messages`, and the status of
+     *         the first one that was not (that one and the rest are the
+     *         caller's to retry or drop).
+     */
+    BatchResult sendBatch(std::span<const std::span<const uint8_t>> messages) noexcept
+    {
+        if (gsoSegment_ > 0)
+            return sendSegmented(messages);
+
+        const std::size_t count = std::min(messages.size(), MAX_BATCH);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            iov_[i].iov_base = const_cast<uint8_t *>(messages[i].data());
+            iov_[i].iov_len = messages[i].size();
+            msghdr &header = batch_[i].msg_hdr;
+            header = {};
+            header.msg_name = &addr_;
+            header.msg_namelen = sizeof(addr_);
+            header.msg_iov = &iov_[i];
+            header.msg_iovlen = 1;
+        }
+        // Paced: one gap between consecutive transmit times, starting where the last sent datagram left off
+        const uint64_t firstTxNs = txTimeGapNs_ > 0 ? nextTxTime() : 0;
+        if (txTimeGapNs_ > 0)
         {
-            std::cerr << "Partial packet sent. Sent " << bytesSent << " but expected "
-                      << data.size() << std::endl;
+            for (std::size_t i = 0; i < count; ++i)
+                attachTxTime(batch_[i].msg_hdr, txTimeControl_[i], firstTxNs + i * txTimeGapNs_);
+        }
+
+        std::size_t done = 0;
+        while (done < count)
+        {
+            int sent = sendmmsg(sockfd_, batch_.data() + done, static_cast<unsigned int>(count - done), 0);
+            if (sent > 0 && txTimeGapNs_ > 0)
+                lastTxNs_ = firstTxNs + (done + static_cast<std::size_t>(sent) - 1) * txTimeGapNs_;
+            if (sent >= 0)
+            {
+                done += static_cast<std::size_t>(sent);
+                continue;
+            }
+
+            // Report what made it and why the next one did not
+            lastError_ = errno;
+            const SendStatus status = sendStatusFromErrno(lastError_);
+            if (status == SendStatus::Failed)
+                logError("sendmmsg failed: {}", std::strerror(lastError_));
+            return {done, status};
         }
+        return {done, SendStatus::Sent};
     }
 
+    static constexpr std::size_t GSO_MAX_SEGMENTS = 64; // UDP_MAX_SEGMENTS of older kernels
+    static constexpr std::size_t GSO_MAX_BYTES = 65507; // One UDP payload before segmentation
+
+    /**
+     * @brief Send each sendBatch() as one UDP GSO super-datagram (UDP_SEGMENT cmsg).
+     *
+     * The kernel cuts the payload into `segmentSize` datagrams, so a batch of
+     * N messages costs one sendmsg() and one trip down the stack. Every
+     * segment but the last must be exactly segmentSize: each message is
+     * padded to it with zero bytes (gathered from a zero buffer, nothing is
+     * copied), so every datagram still carries exactly one message, followed
+     * by padding a FIX reader skips (BodyLength tells it where the message
+     * ends). Messages longer than a segment go out on their own.
+     *
+     * Choose segmentSize >= the usual message and <= MTU - 28. Returns false
+     * and leaves GSO off if the kernel has no UDP_SEGMENT (< 4.18); a send
+     * it rejects later (EINVAL / EIO, e.g. segment over the MTU) switches GSO
+     * off and carries on with sendmmsg().
+     */
+    bool enableGso(uint16_t segmentSize)
+    {
+        int current = 0;
+        socklen_t length = sizeof(current);
+        if (segmentSize == 0 || getsockopt(sockfd_, SOL_UDP, UDP_SEGMENT, &current, &length) < 0)
+        {
+            logWarn("UDP GSO unavailable ({}), sending with sendmmsg", segmentSize == 0 ? "segment size 0" : std::strerror(errno));
+            return false;
+        }
+        gsoSegment_ = segmentSize;
+        gsoPadding_.assign(segmentSize, 0);
+        return true;
+    }
+
+    // Segment size while GSO is on, 0 = off
+    uint16_t gsoSegment() const { return gsoSegment_; }
+
+    static constexpr int PACING_SEND_BUFFER = 32 * 1024; // Doubled by the kernel: a few dozen datagrams in the qdisc
+    static constexpr uint64_t ETF_LEAD_NS = 500'000;     // Etf: how far ahead of now a datagram is scheduled at least
+
+    /**
+     * @brief Let the kernel space the datagrams instead of the sending thread.
+     *
+     * TxTime / Etf: every datagram carries an SCM_TXTIME transmit time one
+     * gap (1e9 / rate ns, rate in datagrams per second) after the previous
+     * one, or now if the sender has fallen behind, so a burst after a stall
+     * still leaves at the set gaps. fq holds each datagram until its time
+     * (a time already past goes at once); etf (CLOCK_TAI) drops a datagram
+     * that reaches it late, so those are scheduled ETF_LEAD_NS ahead.
+     * MaxRate: SO_MAX_PACING_RATE, fq spaces the flow at `rate` bytes per
+     * second of frame (payload + 42 bytes of headers).
+     *
+     * Datagrams waiting in the qdisc hold send buffer, so it is cut to
+     * PACING_SEND_BUFFER: a sender that runs ahead sleeps in send() (the
+     * socket is blocking) once a few dozen are queued, instead of
+     * overflowing fq's per-flow limit (100 by default), where they would be
+     * dropped unseen. Without fq / etf on the egress device the kernel
+     * ignores both and sends at once. UDP GSO is switched off: a
+     * super-datagram would leave as one burst. Returns false and leaves
+     * pacing off if the kernel refuses the option.
+     */
+    bool enablePacing(EgressPacing mode, double rate)
+    {
+        if (mode == EgressPacing::Off || rate <= 0)
+            return false;
+        int result = 0;
+        if (mode == EgressPacing::MaxRate)
+        {
+            const uint64_t bytesPerSecond = static_cast<uint64_t>(rate);
+            result = setsockopt(sockfd_, SOL_SOCKET, SO_MAX_PACING_RATE, &bytesPerSecond, sizeof(bytesPerSecond));
+        }
+        else
+        {
+            const sock_txtime txTime{mode == EgressPacing::Etf ? CLOCK_TAI : CLOCK_MONOTONIC, 0};
+            result = setsockopt(sockfd_, SOL_SOCKET, SO_TXTIME, &txTime, sizeof(txTime));
+        }
+        if (result < 0)
+        {
+            logWarn("Egress pacing unavailable ({}), sending unpaced", std::strerror(errno));
+            return false;
+        }
+
+        if (gsoSegment_ > 0)
+        {
+            logWarn("UDP GSO off: paced datagrams leave one at a time");
+            gsoSegment_ = 0;
+        }
+        int sendBuffer = PACING_SEND_BUFFER;
+        setsockopt(sockfd_, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+        if (mode != EgressPacing::MaxRate)
+        {
+            txTimeClock_ = mode == EgressPacing::Etf ? CLOCK_TAI : CLOCK_MONOTONIC;
+            txTimeGapNs_ = std::max<uint64_t>(static_cast<uint64_t>(1e9 / rate), 1);
+            txTimeLeadNs_ = mode == EgressPacing::Etf ? ETF_LEAD_NS : 0;
+            lastTxNs_ = 0;
+        }
+        return true;
+    }
+
+    // Gap between SCM_TXTIME transmit times, 0 = not stamping
+    uint64_t txTimeGapNs() const { return txTimeGapNs_; }
+
+    // The configured socket and destination, for senders that drive it another way (io_uring)
+    int fd() const { return sockfd_; }
+    const sockaddr_in &destination() const { return addr_; }
+
+    // errno of the last failed send() / sendBatch()
+    int lastError() const { return lastError_; }
+
     /**
      * Rule of Five: Destructor, Copy (assign / constructor), Move (assign / Constructor)
      * Delete copy, allow move
@@ -129,7 +348,9 @@ public:
     UDPMulticastSender &operator=(const UDPMulticastSender &) = delete;
 
     UDPMulticastSender(UDPMulticastSender &&other) noexcept
-        : sockfd_(other.sockfd_), addr_(other.addr_)
+        : sockfd_(other.sockfd_), addr_(other.addr_), gsoSegment_(other.gsoSegment_),
+          gsoPadding_(std::move(other.gsoPadding_)), txTimeClock_(other.txTimeClock_),
+          txTimeGapNs_(other.txTimeGapNs_), txTimeLeadNs_(other.txTimeLeadNs_), lastTxNs_(other.lastTxNs_)
     {
         other.sockfd_ = -1; // Invalidate the other descriptor after moving
     }
@@ -145,6 +366,12 @@ public:
             // Steal the others socket
             sockfd_ = other.sockfd_;
             addr_ = other.addr_;
+            gsoSegment_ = other.gsoSegment_;
+            gsoPadding_ = std::move(other.gsoPadding_);
+            txTimeClock_ = other.txTimeClock_;
+            txTimeGapNs_ = other.txTimeGapNs_;
+            txTimeLeadNs_ = other.txTimeLeadNs_;
+            lastTxNs_ = other.lastTxNs_;
             other.sockfd_ = -1; // Invalidate the others
         }
         return *this;
@@ -153,5 +380,129 @@ public:
 private:
     int sockfd_;         // Socket file descriptor (Integer acts as ID for given socket)
     sockaddr_in addr_{}; // Desination address structure
+    int lastError_ = 0;
+    // sendBatch() scratch, one entry per datagram
+    std::array<mmsghdr, MAX_BATCH> batch_{};
+    std::array<iovec, MAX_BATCH> iov_{};
+    // GSO: segment size (0 = off), zero bytes to pad with, message + padding iovecs
+    uint16_t gsoSegment_ = 0;
+    std::vector<uint8_t> gsoPadding_;
+    std::array<iovec, 2 * GSO_MAX_SEGMENTS> gsoIov_{};
+    // SCM_TXTIME: clock, gap between transmit times (0 = off), etf lead, time of the last datagram sent
+    clockid_t txTimeClock_ = CLOCK_MONOTONIC;
+    uint64_t txTimeGapNs_ = 0;
+    uint64_t txTimeLeadNs_ = 0;
+    uint64_t lastTxNs_ = 0;
+    using TxTimeControl = std::array<char, CMSG_SPACE(sizeof(uint64_t))>;
+    alignas(cmsghdr) std::array<TxTimeControl, MAX_BATCH> txTimeControl_{};
+
+    // One gap after the last datagram sent, or now (+ lead) if the sender has fallen behind
+    uint64_t nextTxTime() const noexcept
+    {
+        timespec ts{};
+        clock_gettime(txTimeClock_, &ts);
+        const uint64_t now = static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec + txTimeLeadNs_;
+        return std::max(lastTxNs_ + txTimeGapNs_, now);
+    }
+
+    static void attachTxTime(msghdr &header, TxTimeControl &control, uint64_t txNs) noexcept
+    {
+        header.msg_control = control.data();
+        header.msg_controllen = control.size();
+        cmsghdr *cmsg = CMSG_FIRSTHDR(&header);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_TXTIME;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(txNs));
+        std::memcpy(CMSG_DATA(cmsg), &txNs, sizeof(txNs));
+    }
+
+    // send() with an SCM_TXTIME transmit time
+    SendStatus sendTimed(std::span<const uint8_t> data) noexcept
+    {
+        iovec iov{const_cast<uint8_t *>(data.data()), data.size()};
+        msghdr header{};
+        header.msg_name = &addr_;
+        header.msg_namelen = sizeof(addr_);
+        header.msg_iov = &iov;
+        header.msg_iovlen = 1;
+        const uint64_t txNs = nextTxTime();
+        attachTxTime(header, txTimeControl_[0], txNs);
+        if (sendmsg(sockfd_, &header, 0) < 0)
+        {
+            lastError_ = errno;
+            const SendStatus status = sendStatusFromErrno(lastError_);
+            if (status == SendStatus::Failed)
+                logError("sendmsg (SCM_TXTIME) failed: {}", std::strerror(lastError_));
+            return status;
+        }
+        lastTxNs_ = txNs;
+        return SendStatus::Sent;
+    }
+
+    // Leading messages that fit a segment, one sendmsg()
+    BatchResult sendSegmented(std::span<const std::span<const uint8_t>> messages) noexcept
+    {
+        const std::size_t segment = gsoSegment_;
+        const std::size_t maxSegments = std::min(GSO_MAX_SEGMENTS, GSO_MAX_BYTES / segment);
+        std::size_t count = 0;
+        std::size_t iovs = 0;
+        std::size_t bytes = 0;
+        while (count < messages.size() && count < maxSegments && messages[count].size() <= segment)
+        {
+            // Pad the previous message out to a full segment, only the last may be short
+            if (count > 0 && messages[count - 1].size() < segment)
+            {
+                gsoIov_[iovs++] = {gsoPadding_.data(), segment - messages[count - 1].size()};
+                bytes += segment - messages[count - 1].size();
+            }
+            gsoIov_[iovs++] = {const_cast<uint8_t *>(messages[count].data()), messages[count].size()};
+            bytes += messages[count].size();
+            ++count;
+        }
+        if (count <= 1)
+        {
+            // Nothing to segment (or bigger than a segment): a plain datagram
+            if (messages.empty())
+                return {0, SendStatus::Sent};
+            const SendStatus status = send(messages[0]);
+            return {status == SendStatus::Sent ? 1u : 0u, status};
+        }
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+        msghdr header{};
+        header.msg_name = &addr_;
+        header.msg_namelen = sizeof(addr_);
+        header.msg_iov = gsoIov_.data();
+        header.msg_iovlen = iovs;
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+        cmsghdr *cmsg = CMSG_FIRSTHDR(&header);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        const uint16_t segmentSize = gsoSegment_;
+        std::memcpy(CMSG_DATA(cmsg), &segmentSize, sizeof(segmentSize));
+
+        ssize_t sent = sendmsg(sockfd_, &header, 0);
+        if (sent >= 0)
+        {
+            if (static_cast<std::size_t>(sent) != bytes)
+                logWarn("Partial GSO send. Sent {} but expected {}", sent, bytes);
+            return {count, SendStatus::Sent};
+        }
+
+        lastError_ = errno;
+        if (lastError_ == EINVAL || lastError_ == EIO || lastError_ == EOPNOTSUPP)
+        {
+            // This path cannot segment (MTU, offload, old kernel): stop trying, resend as sendmmsg
+            logWarn("UDP GSO send rejected ({}), falling back to sendmmsg", std::strerror(lastError_));
+            gsoSegment_ = 0;
+            return sendBatch(messages);
+        }
+        const SendStatus status = sendStatusFromErrno(lastError_);
+        if (status == SendStatus::Failed)
+            logError("sendmsg (GSO) failed: {}", std::strerror(lastError_));
+        return {0, status};
+    }
 };
 #endif // MARKET_DATA_SYSTEM_UDP_SENDER_H
\ No newline at end of file
@@ -0,0 +1,397 @@
+#ifndef MARKET_DATA_SYSTEM_URING_SENDER_H
+#define MARKET_DATA_SYSTEM_URING_SENDER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <core/async_logger.h>
+#include <network/udp_sender.h>
+
+// --- io_uring (raw system calls, no liburing) ---
+#include <linux/io_uring.h>
+#include <sys/mman.h>    // For mmap()
+#include <sys/syscall.h> // For __NR_io_uring_*
+#include <unistd.h>      // For syscall()
+
+struct UringOptions
+{
+    unsigned entries = 256;       // Ring size, also the number of registered send slots
+    bool sqpoll = false;          // Kernel thread polls the submission queue: no syscall per send while it is awake
+    unsigned sqpollIdleMs = 1000; // SQPOLL thread sleeps after this long without work
+};
+
+/**
+ * @brief UDP sender that queues datagrams on an io_uring instead of calling sendto().
+ *
+ * The socket is set up by a UDPMulticastSender (same options, same
+ * destination) and registered as fixed file 0. A slab of `entries` slots of
+ * SLOT_SIZE bytes is registered as fixed buffers: send() copies a datagram
+ * into a free slot and queues an IORING_OP_SEND_ZC from it, so the kernel
+ * neither looks up the fd nor pins the pages per send. Nothing waits for
+ * the kernel: completions are reaped at the start of every send and a slot
+ * is recycled once its notification (buffer no longer referenced) arrives.
+ *
+ * Without SQPOLL one io_uring_enter() submits a whole sendBatch(); with
+ * SQPOLL a kernel thread picks SQEs up and steady state makes no system
+ * call at all (one wake-up after the thread has gone idle).
+ *
+ * Statuses follow UDPMulticastSender: no free slot (everything in flight)
+ * is WouldBlock, waitWritable() parks until a send completes. A send the
+ * kernel rejects later with ENOBUFS / EAGAIN is resubmitted from its slot,
+ * any other failure is logged and the datagram dropped.
+ *
+ * Needs Linux 6.0+ (SEND_ZC with a destination); the constructor throws
+ * if the kernel, seccomp or RLIMIT_MEMLOCK rule it out.
+ */
+class UringMulticastSender
+{
+public:
+    static constexpr std::size_t SLOT_SIZE = 2048; // Largest datagram
+    static constexpr std::size_t MAX_BATCH = 64;   // Datagrams per sendBatch() call
+
+    UringMulticastSender(const std::string &multicast_ip, uint16_t port, const std::string &interface_ip = "127.0.0.1",
+                         const UringOptions &options = {})
+        : socket_{multicast_ip, port, interface_ip}, dest_{socket_.destination()}
+    {
+        try
+        {
+            setupRing(options);
+            registerResources();
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    ~UringMulticastSender()
+    {
+        // In-flight sends still reference the slab, wait for them before unmapping it
+        flush();
+        release();
+    }
+
+    // Owns mappings the kernel points into: neither copied nor moved
+    UringMulticastSender(const UringMulticastSender &) = delete;
+    UringMulticastSender &operator=(const UringMulticastSender &) = delete;
+
+    SendStatus send(std::span<const uint8_t> data) noexcept
+    {
+        reap();
+        const SendStatus status = admit(data);
+        if (status != SendStatus::Sent)
+            return status;
+        queue(stage(data));
+        submit();
+        return SendStatus::Sent;
+    }
+
+    // Queues datagrams while slots are free (up to MAX_BATCH), one submit for all
+    BatchResult sendBatch(std::span<const std::span<const uint8_t>> messages) noexcept
+    {
+        reap();
+        const std::size_t count = std::min(messages.size(), MAX_BATCH);
+        std::size_t queued = 0;
+        SendStatus status = SendStatus::Sent;
+        while (queued < count && (status = admit(messages[queued])) == SendStatus::Sent)
+            queue(stage(messages[queued++]));
+        submit();
+        return {queued, status};
+    }
+
+    // Park until a queued send completes and frees its slot. The timeout is unused: completions
+    // of datagram sends are never far off.
+    bool waitWritable(int /*timeoutMs*/) noexcept
+    {
+        if (!free_.empty())
+            return true;
+        enter(0, 1, IORING_ENTER_GETEVENTS);
+        reap();
+        return !free_.empty();
+    }
+
+    // Block until every queued send has completed and its slot is free again
+    void flush()
+    {
+        if (ringFd_ < 0)
+            return;
+        while (inFlight() > 0)
+        {
+            submit(); // Anything a failed enter left in the ring
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+            reap();
+        }
+    }
+
+    // Sends queued but not yet completed
+    std::size_t inFlight() const { return slots_ - free_.size(); }
+    // errno of the last failure (EAGAIN = no free slot)
+    int lastError() const { return lastError_; }
+    // Sends the kernel pushed back on and that were queued again from their slot
+    uint64_t resubmits() const { return resubmits_; }
+    // io_uring_enter() calls made to submit (SQPOLL: wake-ups only)
+    uint64_t submitCalls() const { return submitCalls_; }
+
+private:
+    UDPMulticastSender socket_; // Declared first: the socket outlives the ring
+    sockaddr_in dest_;          // Stable address for every SQE
+
+    int ringFd_ = -1;
+    bool sqpoll_ = false;
+    void *sqRing_ = nullptr;
+    void *cqRing_ = nullptr;
+    std::size_t sqRingSize_ = 0;
+    std::size_t cqRingSize_ = 0;
+    io_uring_sqe *sqes_ = nullptr;
+    std::size_t sqesSize_ = 0;
+
+    // Pointers into the shared ring mappings
+    unsigned *sqHead_ = nullptr;
+    unsigned *sqTail_ = nullptr;
+    unsigned *sqFlags_ = nullptr;
+    unsigned *sqArray_ = nullptr;
+    unsigned sqMask_ = 0;
+    unsigned *cqHead_ = nullptr;
+    unsigned *cqTail_ = nullptr;
+    io_uring_cqe *cqes_ = nullptr;
+    unsigned cqMask_ = 0;
+    unsigned sqTailLocal_ = 0; // Next SQE, published by submit()
+
+    // Registered send slots
+    uint8_t *slab_ = nullptr;
+    std::size_t slots_ = 0;
+    std::vector<uint32_t> lengths_;
+    std::vector<uint32_t> free_;
+
+    int lastError_ = 0;
+    uint64_t resubmits_ = 0;
+    uint64_t submitCalls_ = 0;
+
+    static unsigned *field(void *base, uint32_t offset)
+    {
+        return reinterpret_cast<unsigned *>(static_cast<char *>(base) + offset);
+    }
+
+    static void *map(int fd, std::size_t size, off_t offset)
+    {
+        void *at = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+        if (at == MAP_FAILED)
+            throw std::runtime_error(std::format("io_uring mmap failed: {}", std::strerror(errno)));
+        return at;
+    }
+
+    void setupRing(const UringOptions &options)
+    {
+        io_uring_params params{};
+        if (options.sqpoll)
+        {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = options.sqpollIdleMs;
+        }
+        ringFd_ = static_cast<int>(syscall(__NR_io_uring_setup, options.entries, &params));
+        if (ringFd_ < 0)
+            throw std::runtime_error(std::format("io_uring_setup failed: {}", std::strerror(errno)));
+        sqpoll_ = options.sqpoll;
+
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        // Both rings in one mapping on every kernel that has SEND_ZC, kept general anyway
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+            sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+        sqRing_ = map(ringFd_, sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = (params.features & IORING_FEAT_SINGLE_MMAP) ? sqRing_ : map(ringFd_, cqRingSize_, IORING_OFF_CQ_RING);
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe *>(map(ringFd_, sqesSize_, IORING_OFF_SQES));
+
+        sqHead_ = field(sqRing_, params.sq_off.head);
+        sqTail_ = field(sqRing_, params.sq_off.tail);
+        sqFlags_ = field(sqRing_, params.sq_off.flags);
+        sqArray_ = field(sqRing_, params.sq_off.array);
+        sqMask_ = *field(sqRing_, params.sq_off.ring_mask);
+        cqHead_ = field(cqRing_, params.cq_off.head);
+        cqTail_ = field(cqRing_, params.cq_off.tail);
+        cqes_ = reinterpret_cast<io_uring_cqe *>(static_cast<char *>(cqRing_) + params.cq_off.cqes);
+        cqMask_ = *field(cqRing_, params.cq_off.ring_mask);
+        sqTailLocal_ = *sqTail_;
+
+        // One slot per SQ entry: in-flight sends never outnumber SQEs, and at two
+        // CQEs per send (result + notification) never overflow the 2x CQ
+        slots_ = params.sq_entries;
+    }
+
+    void registerResources()
+    {
+        // SEND_ZC must be there (6.0+)
+        std::vector<std::byte> probeBytes(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+        auto *probe = reinterpret_cast<io_uring_probe *>(probeBytes.data());
+        if (syscall(__NR_io_uring_register, ringFd_, IORING_REGISTER_PROBE, probe, 256) < 0 ||
+            probe->last_op < IORING_OP_SEND_ZC || !(probe->ops[IORING_OP_SEND_ZC].flags & IO_URING_OP_SUPPORTED))
+            throw std::runtime_error("io_uring: IORING_OP_SEND_ZC not supported by this kernel");
+
+        const std::size_t slabSize = slots_ * SLOT_SIZE;
+        void *slab = mmap(nullptr, slabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (slab == MAP_FAILED)
+            throw std::runtime_error(std::format("io_uring slab mmap failed: {}", std::strerror(errno)));
+        slab_ = static_cast<uint8_t *>(slab);
+
+        std::vector<iovec> buffers(slots_);
+        for (std::size_t i = 0; i < slots_; ++i)
+            buffers[i] = {slab_ + i * SLOT_SIZE, SLOT_SIZE};
+        if (syscall(__NR_io_uring_register, ringFd_, IORING_REGISTER_BUFFERS, buffers.data(), buffers.size()) < 0)
+            throw std::runtime_error(std::format("io_uring buffer registration failed: {}", std::strerror(errno)));
+
+        int fd = socket_.fd();
+        if (syscall(__NR_io_uring_register, ringFd_, IORING_REGISTER_FILES, &fd, 1) < 0)
+            throw std::runtime_error(std::format("io_uring file registration failed: {}", std::strerror(errno)));
+
+        lengths_.assign(slots_, 0);
+        free_.resize(slots_);
+        for (std::size_t i = 0; i < slots_; ++i)
+            free_[i] = static_cast<uint32_t>(slots_ - 1 - i);
+    }
+
+    void release()
+    {
+        if (sqes_)
+            munmap(sqes_, sqesSize_);
+        if (cqRing_ && cqRing_ != sqRing_)
+            munmap(cqRing_, cqRingSize_);
+        if (sqRing_)
+            munmap(sqRing_, sqRingSize_);
+        // Closing the ring drops the buffer / file registrations
+        if (ringFd_ >= 0)
+            close(ringFd_);
+        if (slab_)
+            munmap(slab_, slots_ * SLOT_SIZE);
+        sqes_ = nullptr;
+        sqRing_ = cqRing_ = nullptr;
+        slab_ = nullptr;
+        ringFd_ = -1;
+    }
+
+    int enter(unsigned toSubmit, unsigned minComplete, unsigned flags) noexcept
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, ringFd_, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    // Sent = a slot is free and the datagram fits it
+    SendStatus admit(std::span<const uint8_t> data) noexcept
+    {
+        if (data.size() > SLOT_SIZE)
+        {
+            lastError_ = EMSGSIZE;
+            logError("io_uring send: {} byte datagram exceeds the {} byte slot", data.size(), SLOT_SIZE);
+            return SendStatus::Failed;
+        }
+        if (free_.empty())
+        {
+            lastError_ = EAGAIN;
+            return SendStatus::WouldBlock;
+        }
+        return SendStatus::Sent;
+    }
+
+    // Copy into a free slot, the datagram's buffer is the caller's again on return
+    uint32_t stage(std::span<const uint8_t> data) noexcept
+    {
+        const uint32_t slot = free_.back();
+        free_.pop_back();
+        std::memcpy(slab_ + slot * SLOT_SIZE, data.data(), data.size());
+        lengths_[slot] = static_cast<uint32_t>(data.size());
+        return slot;
+    }
+
+    void queue(uint32_t slot) noexcept
+    {
+        const unsigned index = sqTailLocal_ & sqMask_;
+        io_uring_sqe &sqe = sqes_[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_SEND_ZC;
+        sqe.flags = IOSQE_FIXED_FILE;
+        sqe.fd = 0; // Registered file index
+        sqe.addr = reinterpret_cast<uint64_t>(slab_ + slot * SLOT_SIZE);
+        sqe.len = lengths_[slot];
+        sqe.ioprio = IORING_RECVSEND_FIXED_BUF;
+        sqe.buf_index = static_cast<uint16_t>(slot);
+        sqe.addr2 = reinterpret_cast<uint64_t>(&dest_);
+        sqe.addr_len = sizeof(dest_);
+        sqe.user_data = slot;
+        sqArray_[index] = index;
+        ++sqTailLocal_;
+    }
+
+    // Publish queued SQEs; enter the kernel unless an awake SQPOLL thread will pick them up
+    void submit() noexcept
+    {
+        std::atomic_ref<unsigned>(*sqTail_).store(sqTailLocal_, std::memory_order_release);
+        if (sqpoll_)
+        {
+            // The tail store must be visible before the flag is read (pairs with the SQPOLL thread going idle)
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (std::atomic_ref<unsigned>(*sqFlags_).load(std::memory_order_relaxed) & IORING_SQ_NEED_WAKEUP)
+            {
+                enter(0, 0, IORING_ENTER_SQ_WAKEUP);
+                ++submitCalls_;
+            }
+            return;
+        }
+        const unsigned pending = sqTailLocal_ - std::atomic_ref<unsigned>(*sqHead_).load(std::memory_order_acquire);
+        if (pending == 0)
+            return;
+        if (enter(pending, 0, 0) < 0)
+        {
+            // Left in the ring, the next submit() hands them over again
+            lastError_ = errno;
+        }
+        ++submitCalls_;
+    }
+
+    // Drain the completion queue without waiting: recycle slots, resubmit pushed-back sends
+    void reap() noexcept
+    {
+        unsigned head = std::atomic_ref<unsigned>(*cqHead_).load(std::memory_order_relaxed);
+        const unsigned tail = std::atomic_ref<unsigned>(*cqTail_).load(std::memory_order_acquire);
+        bool resubmit = false;
+        for (; head != tail; ++head)
+        {
+            const io_uring_cqe &cqe = cqes_[head & cqMask_];
+            const auto slot = static_cast<uint32_t>(cqe.user_data);
+            // SEND_ZC: a result, then (F_MORE) a notification once the kernel let go of the buffer
+            if (cqe.flags & IORING_CQE_F_NOTIF)
+            {
+                free_.push_back(slot);
+                continue;
+            }
+            const bool notifyFollows = cqe.flags & IORING_CQE_F_MORE;
+            if (cqe.res < 0)
+            {
+                lastError_ = -cqe.res;
+                if (!notifyFollows && (lastError_ == ENOBUFS || lastError_ == EAGAIN))
+                {
+                    queue(slot);
+                    ++resubmits_;
+                    resubmit = true;
+                    continue;
+                }
+                logError("io_uring send failed: {}", std::strerror(lastError_));
+            }
+            if (!notifyFollows)
+                free_.push_back(slot);
+        }
+        std::atomic_ref<unsigned>(*cqHead_).store(head, std::memory_order_release);
+        if (resubmit)
+            submit();
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_URING_SENDER_H
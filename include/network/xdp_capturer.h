@@ -0,0 +1,247 @@
+#ifndef MARKET_DATA_SYSTEM_XDP_CAPTURER_H
+#define MARKET_DATA_SYSTEM_XDP_CAPTURER_H
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+#include <core/async_logger.h>
+#include <network/udp_frame.h>
+#include <network/xdp_socket.h>
+
+// --- eBPF (raw bpf() system call, program assembled below) ---
+#include <linux/bpf.h>     // For bpf_attr, bpf_insn, BPF_* opcodes
+#include <linux/if_link.h> // For XDP_FLAGS_*
+#include <sys/syscall.h>   // For __NR_bpf
+#include <unistd.h>        // For syscall(), close()
+
+/**
+ * @brief XDP program that steers one UDP port to an AF_XDP socket, attached while alive.
+ *
+ * Assembled by hand (no compiler, no libbpf): IPv4 without options, UDP,
+ * destination port `port` -> bpf_redirect_map(xsks, rx_queue_index,
+ * XDP_PASS), so a queue without a socket and all other traffic (ARP, other
+ * ports) carry on up the stack. Attached through a BPF link, in driver
+ * mode where the driver has it and generic (SKB) mode otherwise; the link
+ * goes away with this object.
+ */
+class XdpRedirectProgram
+{
+public:
+    XdpRedirectProgram(int ifindex, uint16_t port, unsigned queues = 64)
+    {
+        try
+        {
+            createMap(queues);
+            load(port);
+            attach(ifindex);
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    ~XdpRedirectProgram() { release(); }
+
+    XdpRedirectProgram(const XdpRedirectProgram &) = delete;
+    XdpRedirectProgram &operator=(const XdpRedirectProgram &) = delete;
+
+    // Packets of `queue` go to this socket from now on
+    void bindSocket(unsigned queue, int socketFd)
+    {
+        bpf_attr attr{};
+        attr.map_fd = static_cast<uint32_t>(mapFd_);
+        attr.key = reinterpret_cast<uint64_t>(&queue);
+        attr.value = reinterpret_cast<uint64_t>(&socketFd);
+        if (bpf(BPF_MAP_UPDATE_ELEM, attr) < 0)
+            throw std::runtime_error(std::format("XSKMAP update failed: {}", std::strerror(errno)));
+    }
+
+    bool driverMode() const { return driverMode_; }
+
+private:
+    int mapFd_ = -1;
+    int progFd_ = -1;
+    int linkFd_ = -1;
+    bool driverMode_ = false;
+
+    static int bpf(int command, bpf_attr &attr) noexcept
+    {
+        return static_cast<int>(syscall(__NR_bpf, command, &attr, sizeof(attr)));
+    }
+
+    static bpf_insn insn(uint8_t code, uint8_t dst, uint8_t src, int16_t off, int32_t imm)
+    {
+        bpf_insn instruction{};
+        instruction.code = code;
+        instruction.dst_reg = dst & 0xF;
+        instruction.src_reg = src & 0xF;
+        instruction.off = off;
+        instruction.imm = imm;
+        return instruction;
+    }
+
+    void createMap(unsigned queues)
+    {
+        bpf_attr attr{};
+        attr.map_type = BPF_MAP_TYPE_XSKMAP;
+        attr.key_size = sizeof(uint32_t);
+        attr.value_size = sizeof(uint32_t);
+        attr.max_entries = queues;
+        mapFd_ = bpf(BPF_MAP_CREATE, attr);
+        if (mapFd_ < 0)
+            throw std::runtime_error(std::format("XSKMAP create failed: {}", std::strerror(errno)));
+    }
+
+    void load(uint16_t port)
+    {
+        // Jumps are relative to the next instruction; PASS is the last two
+        constexpr int16_t PASS = 19;
+        auto toPass = [](int16_t at) { return static_cast<int16_t>(PASS - at - 1); };
+        // Loaded 16-bit fields are in network order, so compare against network-order constants
+        const int32_t ipv4 = htons(ETH_P_IP);
+        const int32_t udpPort = htons(port);
+        const std::array<bpf_insn, 21> program = {
+            insn(BPF_LDX | BPF_W | BPF_MEM, 2, 1, offsetof(xdp_md, data), 0),           // 0: r2 = data
+            insn(BPF_LDX | BPF_W | BPF_MEM, 3, 1, offsetof(xdp_md, data_end), 0),       // 1: r3 = data_end
+            insn(BPF_ALU64 | BPF_MOV | BPF_X, 4, 2, 0, 0),                              // 2: r4 = data
+            insn(BPF_ALU64 | BPF_ADD | BPF_K, 4, 0, 0, UdpFrameTemplate::HEADERS_SIZE), // 3: r4 += 42
+            insn(BPF_JMP | BPF_JGT | BPF_X, 4, 3, toPass(4), 0),                        // 4: short frame
+            insn(BPF_LDX | BPF_H | BPF_MEM, 4, 2, 12, 0),                               // 5: EtherType
+            insn(BPF_JMP | BPF_JNE | BPF_K, 4, 0, toPass(6), ipv4),                     // 6
+            insn(BPF_LDX | BPF_B | BPF_MEM, 4, 2, 14, 0),                               // 7: version / IHL
+            insn(BPF_JMP | BPF_JNE | BPF_K, 4, 0, toPass(8), 0x45),                     // 8
+            insn(BPF_LDX | BPF_B | BPF_MEM, 4, 2, 23, 0),                               // 9: IP protocol
+            insn(BPF_JMP | BPF_JNE | BPF_K, 4, 0, toPass(10), IPPROTO_UDP),             // 10
+            insn(BPF_LDX | BPF_H | BPF_MEM, 4, 2, 36, 0),                               // 11: UDP dest port
+            insn(BPF_JMP | BPF_JNE | BPF_K, 4, 0, toPass(12), udpPort),                 // 12
+            insn(BPF_LDX | BPF_W | BPF_MEM, 2, 1, offsetof(xdp_md, rx_queue_index), 0), // 13: r2 = queue
+            insn(BPF_LD | BPF_DW | BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0, mapFd_),           // 14: r1 = xsks
+            insn(0, 0, 0, 0, 0),                                                        // 15: (upper half)
+            insn(BPF_ALU64 | BPF_MOV | BPF_K, 3, 0, 0, XDP_PASS),                       // 16: r3 = fallback
+            insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),                   // 17
+            insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),                                       // 18
+            insn(BPF_ALU64 | BPF_MOV | BPF_K, 0, 0, 0, XDP_PASS),                       // 19: PASS
+            insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),                                       // 20
+        };
+
+        static const char license[] = "GPL"; // bpf_redirect_map is GPL-only
+        std::array<char, 4096> log{};
+        bpf_attr attr{};
+        attr.prog_type = BPF_PROG_TYPE_XDP;
+        attr.insns = reinterpret_cast<uint64_t>(program.data());
+        attr.insn_cnt = program.size();
+        attr.license = reinterpret_cast<uint64_t>(license);
+        attr.log_buf = reinterpret_cast<uint64_t>(log.data());
+        attr.log_size = log.size();
+        attr.log_level = 1;
+        progFd_ = bpf(BPF_PROG_LOAD, attr);
+        if (progFd_ < 0)
+            throw std::runtime_error(std::format("XDP program load failed: {} {}", std::strerror(errno), log.data()));
+    }
+
+    void attach(int ifindex)
+    {
+        for (uint32_t mode : {XDP_FLAGS_DRV_MODE, XDP_FLAGS_SKB_MODE})
+        {
+            bpf_attr attr{};
+            attr.link_create.prog_fd = static_cast<uint32_t>(progFd_);
+            attr.link_create.target_ifindex = static_cast<uint32_t>(ifindex);
+            attr.link_create.attach_type = BPF_XDP;
+            attr.link_create.flags = mode;
+            linkFd_ = bpf(BPF_LINK_CREATE, attr);
+            if (linkFd_ >= 0)
+            {
+                driverMode_ = mode == XDP_FLAGS_DRV_MODE;
+                return;
+            }
+        }
+        throw std::runtime_error(std::format("XDP attach failed: {}", std::strerror(errno)));
+    }
+
+    void release() noexcept
+    {
+        // Closing the link detaches the program
+        for (int *fd : {&linkFd_, &progFd_, &mapFd_})
+        {
+            if (*fd >= 0)
+                close(*fd);
+            *fd = -1;
+        }
+    }
+};
+
+/**
+ * @brief Analyzer source on AF_XDP: UDP payloads of one port, bypassing the socket layer.
+ *
+ * Same callback as PacketCapturer (payload pointer and size), but packets
+ * are steered by XdpRedirectProgram into an AF_XDP socket's UMEM instead of
+ * being copied to libpcap's buffer, and never reach the IP stack (so a UDP
+ * socket on the port sees nothing while this runs). Receives on one device
+ * queue: veth and most test setups have one.
+ */
+class XdpCapturer
+{
+public:
+    using PacketCallback = std::function<void(const uint8_t *, size_t)>;
+
+    XdpCapturer(const std::string &device, uint16_t port, const XdpOptions &options = {})
+        : socket_{device, XdpSocket::Direction::Receive, options}, program_{socket_.ifindex(), port}, port_{port}
+    {
+        program_.bindSocket(options.queue, socket_.fd());
+        logInfo("AF_XDP capture on {} queue {} udp port {}: {} mode, {} XDP", device, options.queue, port,
+                socket_.zeroCopy() ? "zero-copy" : "copy", program_.driverMode() ? "driver" : "generic");
+    }
+
+    // Blocking loop, like PacketCapturer::startCapture(), until stop()
+    void startCapture(PacketCallback cb)
+    {
+        running_.store(true, std::memory_order_relaxed);
+        while (running_.load(std::memory_order_relaxed))
+        {
+            if (poll(cb, 100) == 0)
+                continue;
+        }
+    }
+
+    void stop() { running_.store(false, std::memory_order_relaxed); }
+
+    /**
+     * Deliver what has arrived (waiting up to timeoutMs for the first
+     * packet, 0 = no wait). Returns the number of payloads delivered.
+     */
+    std::size_t poll(const PacketCallback &cb, int timeoutMs = 0)
+    {
+        std::size_t delivered = 0;
+        auto onFrame = [&](std::span<const uint8_t> frame)
+        {
+            std::span<const uint8_t> payload = udpPayload(frame, port_);
+            if (!payload.empty())
+            {
+                cb(payload.data(), payload.size());
+                ++delivered;
+            }
+        };
+        if (socket_.receive(onFrame) == 0 && timeoutMs > 0 && socket_.wait(timeoutMs))
+            socket_.receive(onFrame);
+        return delivered;
+    }
+
+    bool zeroCopy() const { return socket_.zeroCopy(); }
+
+private:
+    XdpSocket socket_; // Declared first: bound into the program's map, outlives the link
+    XdpRedirectProgram program_;
+    uint16_t port_;
+    std::atomic<bool> running_{false};
+};
+
+#endif // MARKET_DATA_SYSTEM_XDP_CAPTURER_H
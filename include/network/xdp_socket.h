@@ -0,0 +1,446 @@
+#ifndef MARKET_DATA_SYSTEM_XDP_SOCKET_H
+#define MARKET_DATA_SYSTEM_XDP_SOCKET_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <core/async_logger.h>
+#include <network/udp_frame.h>
+#include <network/udp_sender.h> // SendStatus, BatchResult
+
+// --- AF_XDP (kernel UAPI only, no libbpf / libxdp) ---
+#include <linux/if_xdp.h> // For xdp_umem_reg, xdp_mmap_offsets, xdp_desc, sockaddr_xdp
+#include <net/if.h>       // For if_nametoindex()
+#include <poll.h>         // For poll()
+#include <sys/mman.h>     // For mmap()
+#include <sys/socket.h>   // For AF_XDP, SOL_XDP
+#include <unistd.h>       // For close()
+
+struct XdpOptions
+{
+    unsigned frames = 4096;    // UMEM frames, a power of two; every ring has as many entries
+    unsigned frameSize = 2048; // Bytes per UMEM frame, 2048 or 4096
+    unsigned queue = 0;        // Device queue the socket binds to
+    bool zeroCopy = true;      // Tried first; copy mode where the driver has none (veth, generic XDP)
+};
+
+/**
+ * @brief One AF_XDP socket: a UMEM of fixed frames plus its rings, mapped from the kernel.
+ *
+ * A Transmit socket owns a TX ring and the completion ring: a frame is
+ * taken from the free list, written, queued on TX; the kernel hands it back
+ * on the completion ring once sent. A Receive socket owns an RX ring and
+ * the fill ring: every frame starts on the fill ring, the kernel writes a
+ * packet into one and posts it on RX, and it goes back to the fill ring as
+ * soon as the callback returns. (The kernel insists on a fill and a
+ * completion ring either way; the unused one stays empty.)
+ *
+ * Rings are single producer / single consumer between this thread and the
+ * kernel: indexes are free-running, loaded with acquire and published with
+ * release. With XDP_USE_NEED_WAKEUP the kernel says when it needs a
+ * system call to make progress, otherwise none is made.
+ *
+ * Receiving also needs an XDP program redirecting packets to the socket
+ * (XdpCapturer). Needs CAP_NET_ADMIN / CAP_NET_RAW and Linux 5.4+.
+ */
+class XdpSocket
+{
+public:
+    enum class Direction
+    {
+        Receive,
+        Transmit,
+    };
+
+    static constexpr uint64_t NO_FRAME = ~uint64_t{0};
+
+    XdpSocket(const std::string &device, Direction direction, const XdpOptions &options = {})
+        : direction_{direction}
+    {
+        if (!std::has_single_bit(options.frames) || !std::has_single_bit(options.frameSize))
+            throw std::invalid_argument("XDP frames and frameSize must be powers of two");
+        ifindex_ = static_cast<int>(if_nametoindex(device.c_str()));
+        if (ifindex_ == 0)
+            throw std::runtime_error(std::format("No interface named {}", device));
+
+        fd_ = socket(AF_XDP, SOCK_RAW, 0);
+        if (fd_ < 0)
+            throw std::runtime_error(std::format("AF_XDP socket failed: {}", std::strerror(errno)));
+        try
+        {
+            setupUmem(options);
+            setupRings(options);
+            bindDevice(device, options);
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    ~XdpSocket() { release(); }
+
+    // Owns mappings the kernel writes into: neither copied nor moved
+    XdpSocket(const XdpSocket &) = delete;
+    XdpSocket &operator=(const XdpSocket &) = delete;
+
+    int fd() const { return fd_; }
+    int ifindex() const { return ifindex_; }
+    bool zeroCopy() const { return zeroCopy_; }
+    std::size_t frameSize() const { return frameSize_; }
+    uint8_t *frame(uint64_t address) noexcept { return umem_ + address; }
+
+    // --- Transmit ---
+
+    // A free UMEM frame to write the next packet into, NO_FRAME while all are queued / in flight
+    uint64_t acquire() noexcept
+    {
+        if (free_.empty())
+            reapCompletions();
+        if (free_.empty())
+            return NO_FRAME;
+        const uint64_t address = free_.back();
+        free_.pop_back();
+        return address;
+    }
+
+    // Queue `length` bytes at `address` for transmission (visible to the kernel after kick())
+    void queue(uint64_t address, uint32_t length) noexcept
+    {
+        xdp_desc &desc = static_cast<xdp_desc *>(tx_.descs)[tx_.local & tx_.mask];
+        desc.addr = address;
+        desc.len = length;
+        desc.options = 0;
+        ++tx_.local;
+    }
+
+    /**
+     * Publish queued descriptors and wake the kernel if it asked to be. In
+     * copy mode every kick transmits at most a small batch in the calling
+     * thread (EAGAIN = more left), so it repeats while descriptors remain.
+     * Returns 0, or the errno of the last system call (EBUSY: the device
+     * dropped a frame; the frame still completes).
+     */
+    int kick() noexcept
+    {
+        std::atomic_ref<uint32_t>(*tx_.producer).store(tx_.local, std::memory_order_release);
+        int error = 0;
+        for (int attempt = 0; attempt < KICK_ATTEMPTS && needsWakeup(tx_); ++attempt)
+        {
+            ++kicks_;
+            if (sendto(fd_, nullptr, 0, MSG_DONTWAIT, nullptr, 0) >= 0)
+                return 0;
+            error = errno;
+            if (error != EAGAIN || pending(tx_) == 0)
+                break;
+        }
+        return error;
+    }
+
+    // Frames queued or in flight (not yet back on the completion ring)
+    std::size_t inFlight() const { return frames_ - free_.size(); }
+
+    // --- Receive ---
+
+    /**
+     * Hand up to `budget` received packets to onPacket(span of the frame),
+     * then give their frames back to the kernel. Returns how many.
+     */
+    template <typename OnPacket>
+    std::size_t receive(OnPacket &&onPacket, std::size_t budget = 64)
+    {
+        const uint32_t produced = std::atomic_ref<uint32_t>(*rx_.producer).load(std::memory_order_acquire);
+        const std::size_t count = std::min<std::size_t>(produced - rx_.local, budget);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const xdp_desc &desc = static_cast<const xdp_desc *>(rx_.descs)[(rx_.local + i) & rx_.mask];
+            onPacket(std::span<const uint8_t>(umem_ + desc.addr, desc.len));
+            // Aligned chunks: the frame is the address rounded down, whatever headroom the kernel used
+            static_cast<uint64_t *>(fill_.descs)[fill_.local++ & fill_.mask] = desc.addr & ~(frameSize_ - 1);
+        }
+        if (count == 0)
+            return 0;
+        rx_.local += static_cast<uint32_t>(count);
+        std::atomic_ref<uint32_t>(*rx_.consumer).store(rx_.local, std::memory_order_release);
+        std::atomic_ref<uint32_t>(*fill_.producer).store(fill_.local, std::memory_order_release);
+        if (needsWakeup(fill_))
+            recvfrom(fd_, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+        return count;
+    }
+
+    // Park until a packet arrives (Receive) or a frame completes (Transmit), or timeoutMs passes
+    bool wait(int timeoutMs) noexcept
+    {
+        pollfd entry{fd_, static_cast<short>(direction_ == Direction::Receive ? POLLIN : POLLOUT), 0};
+        return poll(&entry, 1, timeoutMs) > 0;
+    }
+
+    // System calls made to wake the kernel for transmission
+    uint64_t kicks() const { return kicks_; }
+
+private:
+    // The four rings share a layout: producer, consumer, flags, descriptors
+    struct Ring
+    {
+        uint32_t *producer = nullptr;
+        uint32_t *consumer = nullptr;
+        uint32_t *flags = nullptr;
+        void *descs = nullptr;
+        uint32_t mask = 0;
+        uint32_t local = 0; // Our side's next index: producer for TX / fill, consumer for RX / completion
+        void *map = nullptr;
+        std::size_t mapSize = 0;
+    };
+
+    static constexpr int KICK_ATTEMPTS = 16;
+
+    Direction direction_;
+    int fd_ = -1;
+    int ifindex_ = 0;
+    bool zeroCopy_ = false;
+    uint8_t *umem_ = nullptr;
+    std::size_t umemSize_ = 0;
+    std::size_t frames_ = 0;
+    std::size_t frameSize_ = 0;
+    Ring rx_, tx_, fill_, completion_;
+    std::vector<uint64_t> free_; // Transmit: frames not queued or in flight
+    uint64_t kicks_ = 0;
+
+    void setupUmem(const XdpOptions &options)
+    {
+        frames_ = options.frames;
+        frameSize_ = options.frameSize;
+        umemSize_ = frames_ * frameSize_;
+        void *umem = mmap(nullptr, umemSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (umem == MAP_FAILED)
+            throw std::runtime_error(std::format("UMEM mmap failed: {}", std::strerror(errno)));
+        umem_ = static_cast<uint8_t *>(umem);
+
+        xdp_umem_reg reg{};
+        reg.addr = reinterpret_cast<uint64_t>(umem_);
+        reg.len = umemSize_;
+        reg.chunk_size = static_cast<uint32_t>(frameSize_);
+        if (setsockopt(fd_, SOL_XDP, XDP_UMEM_REG, &reg, sizeof(reg)) < 0)
+            throw std::runtime_error(std::format("XDP_UMEM_REG failed: {}", std::strerror(errno)));
+    }
+
+    void setupRings(const XdpOptions &options)
+    {
+        const int entries = static_cast<int>(options.frames);
+        const bool receive = direction_ == Direction::Receive;
+        if (setsockopt(fd_, SOL_XDP, XDP_UMEM_FILL_RING, &entries, sizeof(entries)) < 0 ||
+            setsockopt(fd_, SOL_XDP, XDP_UMEM_COMPLETION_RING, &entries, sizeof(entries)) < 0 ||
+            setsockopt(fd_, SOL_XDP, receive ? XDP_RX_RING : XDP_TX_RING, &entries, sizeof(entries)) < 0)
+            throw std::runtime_error(std::format("AF_XDP ring setup failed: {}", std::strerror(errno)));
+
+        xdp_mmap_offsets offsets{};
+        socklen_t length = sizeof(offsets);
+        if (getsockopt(fd_, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &length) < 0)
+            throw std::runtime_error(std::format("XDP_MMAP_OFFSETS failed: {}", std::strerror(errno)));
+
+        mapRing(fill_, offsets.fr, XDP_UMEM_PGOFF_FILL_RING, sizeof(uint64_t), options.frames);
+        mapRing(completion_, offsets.cr, XDP_UMEM_PGOFF_COMPLETION_RING, sizeof(uint64_t), options.frames);
+        if (receive)
+        {
+            mapRing(rx_, offsets.rx, XDP_PGOFF_RX_RING, sizeof(xdp_desc), options.frames);
+            // Every frame waits on the fill ring for a packet
+            for (std::size_t i = 0; i < frames_; ++i)
+                static_cast<uint64_t *>(fill_.descs)[fill_.local++ & fill_.mask] = i * frameSize_;
+            std::atomic_ref<uint32_t>(*fill_.producer).store(fill_.local, std::memory_order_release);
+        }
+        else
+        {
+            mapRing(tx_, offsets.tx, XDP_PGOFF_TX_RING, sizeof(xdp_desc), options.frames);
+            free_.reserve(frames_);
+            for (std::size_t i = frames_; i-- > 0;)
+                free_.push_back(i * frameSize_);
+        }
+    }
+
+    void mapRing(Ring &ring, const xdp_ring_offset &offset, off_t pageOffset, std::size_t entrySize, unsigned entries)
+    {
+        ring.mapSize = offset.desc + entries * entrySize;
+        ring.map = mmap(nullptr, ring.mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, pageOffset);
+        if (ring.map == MAP_FAILED)
+        {
+            ring.map = nullptr;
+            throw std::runtime_error(std::format("AF_XDP ring mmap failed: {}", std::strerror(errno)));
+        }
+        auto *base = static_cast<uint8_t *>(ring.map);
+        ring.producer = reinterpret_cast<uint32_t *>(base + offset.producer);
+        ring.consumer = reinterpret_cast<uint32_t *>(base + offset.consumer);
+        ring.flags = reinterpret_cast<uint32_t *>(base + offset.flags);
+        ring.descs = base + offset.desc;
+        ring.mask = entries - 1;
+        // Producer rings start at the kernel's producer, consumer rings at its consumer (both 0 when new)
+        ring.local = 0;
+    }
+
+    void bindDevice(const std::string &device, const XdpOptions &options)
+    {
+        sockaddr_xdp address{};
+        address.sxdp_family = AF_XDP;
+        address.sxdp_ifindex = static_cast<uint32_t>(ifindex_);
+        address.sxdp_queue_id = options.queue;
+        if (options.zeroCopy)
+        {
+            address.sxdp_flags = XDP_ZEROCOPY | XDP_USE_NEED_WAKEUP;
+            if (bind(fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0)
+            {
+                zeroCopy_ = true;
+                return;
+            }
+        }
+        address.sxdp_flags = XDP_COPY | XDP_USE_NEED_WAKEUP;
+        if (bind(fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+            throw std::runtime_error(
+                std::format("AF_XDP bind to {} queue {} failed: {}", device, options.queue, std::strerror(errno)));
+    }
+
+    void release() noexcept
+    {
+        for (Ring *ring : {&rx_, &tx_, &fill_, &completion_})
+        {
+            if (ring->map)
+                munmap(ring->map, ring->mapSize);
+            ring->map = nullptr;
+        }
+        if (fd_ >= 0)
+            close(fd_);
+        if (umem_)
+            munmap(umem_, umemSize_);
+        fd_ = -1;
+        umem_ = nullptr;
+    }
+
+    static bool needsWakeup(const Ring &ring) noexcept
+    {
+        return std::atomic_ref<uint32_t>(*ring.flags).load(std::memory_order_relaxed) & XDP_RING_NEED_WAKEUP;
+    }
+
+    // Descriptors published on a producer ring the kernel has not consumed yet
+    static uint32_t pending(const Ring &ring) noexcept
+    {
+        return ring.local - std::atomic_ref<uint32_t>(*ring.consumer).load(std::memory_order_acquire);
+    }
+
+    // Sent frames back to the free list
+    void reapCompletions() noexcept
+    {
+        const uint32_t produced = std::atomic_ref<uint32_t>(*completion_.producer).load(std::memory_order_acquire);
+        for (; completion_.local != produced; ++completion_.local)
+            free_.push_back(static_cast<const uint64_t *>(completion_.descs)[completion_.local & completion_.mask]);
+        std::atomic_ref<uint32_t>(*completion_.consumer).store(completion_.local, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief UDP/IPv4 sender on an AF_XDP socket: frames written straight into the UMEM.
+ *
+ * Same frames as PacketRingSender (UdpFrameTemplate: headers prebuilt,
+ * lengths and IP checksum patched), same statuses: no free UMEM frame is
+ * WouldBlock, waitWritable() waits for completions. sendBatch() queues up
+ * to MAX_BATCH frames and kicks once. Zero-copy where the driver supports
+ * it, copy mode otherwise (veth, generic XDP). A frame the device drops
+ * (EBUSY) still counts as sent, as with sendto(); see deviceDrops().
+ */
+class XdpSender
+{
+public:
+    static constexpr std::size_t MAX_BATCH = 64; // Datagrams per sendBatch() call
+
+    XdpSender(const std::string &dest_ip, uint16_t port, const std::string &interface_ip, const XdpOptions &options = {})
+        : device_{NetInterface::owning(parseIpv4(interface_ip))},
+          frameTemplate_{device_, parseIpv4(interface_ip), parseIpv4(dest_ip), port},
+          socket_{device_.name, XdpSocket::Direction::Transmit, options},
+          maxDatagram_{std::min(socket_.frameSize(), device_.mtu + sizeof(ether_header)) - UdpFrameTemplate::HEADERS_SIZE}
+    {
+        logInfo("AF_XDP sender on {} queue {}: {} mode, {} frames of {} B", device_.name, options.queue,
+                socket_.zeroCopy() ? "zero-copy" : "copy", options.frames, options.frameSize);
+    }
+
+    SendStatus send(std::span<const uint8_t> data) noexcept
+    {
+        const SendStatus status = stage(data);
+        if (status == SendStatus::Sent)
+            kick();
+        return status;
+    }
+
+    BatchResult sendBatch(std::span<const std::span<const uint8_t>> messages) noexcept
+    {
+        const std::size_t count = std::min(messages.size(), MAX_BATCH);
+        std::size_t staged = 0;
+        SendStatus status = SendStatus::Sent;
+        while (staged < count && (status = stage(messages[staged])) == SendStatus::Sent)
+            ++staged;
+        if (staged > 0)
+            kick();
+        return {staged, status};
+    }
+
+    bool waitWritable(int timeoutMs) noexcept
+    {
+        kick(); // Anything a refused kick left queued
+        return socket_.wait(timeoutMs);
+    }
+
+    std::size_t maxDatagram() const { return maxDatagram_; }
+    bool zeroCopy() const { return socket_.zeroCopy(); }
+    int lastError() const { return lastError_; }
+    // System calls made to transmit
+    uint64_t kicks() const { return socket_.kicks(); }
+    // Kicks the device dropped a frame on
+    uint64_t deviceDrops() const { return deviceDrops_; }
+
+private:
+    NetInterface device_;
+    UdpFrameTemplate frameTemplate_;
+    XdpSocket socket_;
+    std::size_t maxDatagram_;
+    int lastError_ = 0;
+    uint64_t deviceDrops_ = 0;
+
+    SendStatus stage(std::span<const uint8_t> data) noexcept
+    {
+        if (data.size() > maxDatagram_)
+        {
+            lastError_ = EMSGSIZE;
+            logError("AF_XDP send: {} byte datagram exceeds the {} byte maximum", data.size(), maxDatagram_);
+            return SendStatus::Failed;
+        }
+        const uint64_t address = socket_.acquire();
+        if (address == XdpSocket::NO_FRAME)
+        {
+            lastError_ = EAGAIN;
+            return SendStatus::WouldBlock;
+        }
+        socket_.queue(address, static_cast<uint32_t>(frameTemplate_.write(socket_.frame(address), data)));
+        return SendStatus::Sent;
+    }
+
+    void kick() noexcept
+    {
+        const int error = socket_.kick();
+        if (error == 0 || error == EAGAIN)
+            return;
+        lastError_ = error;
+        if (error == EBUSY || error == ENOBUFS)
+            ++deviceDrops_;
+        else
+            logError("AF_XDP transmit failed: {}", std::strerror(error));
+    }
+};
+
+#endif // MARKET_DATA_SYSTEM_XDP_SOCKET_H
@@ -1,8 +1,18 @@
-#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+#include <core/async_logger.h>
+#include <network/arrival_gaps.h>
 #include <network/packet_capturer.h>
+#include <network/socket_capturer.h>
+#include <network/xdp_capturer.h>
 
 const std::string BPF_FILTER = "udp port 9999";
+const uint16_t CAPTURE_PORT = 9999;
 const std::string CAPTURE_DEVICE = "en0";
+const std::string CAPTURE_GROUP = "239.255.1.1";
+const int64_t GAP_REPORT_NS = 1'000'000'000;
 
 /**
  * This is our C++ callback function.
@@ -10,32 +20,119 @@ const std::string CAPTURE_DEVICE = "en0";
  */
 void onPacketReceived(const uint8_t *data, size_t size)
 {
-    std::cout << "--- PACKET RECEIVED (" << size << " bytes) ---" << std::endl;
+    // Print the raw FIX message (copied into the log record, formatted off the capture thread)
+    std::string_view fixMessage(reinterpret_cast<const char *>(data), size);
+    logInfo("--- PACKET RECEIVED ({} bytes) ---\n{}", size, fixMessage);
+}
 
-    // Print the raw FIX message
-    std::string fixMessage(reinterpret_cast<const char *>(data), size);
-    std::cout << fixMessage << std::endl;
+void logGaps(const ArrivalGaps::Summary &summary, uint64_t expectedGapNs)
+{
+    const double rate = summary.seconds > 0 ? summary.gaps / summary.seconds : 0.0;
+    if (expectedGapNs == 0)
+    {
+        logInfo("[Gaps] {} pkts/s | gap ns min {} p1 {} p50 {} p99 {} max {}", static_cast<uint64_t>(rate),
+                summary.minNs, summary.p1Ns, summary.p50Ns, summary.p99Ns, summary.maxNs);
+        return;
+    }
+    logInfo("[Gaps] {} pkts/s | gap ns min {} p1 {} p50 {} p99 {} max {} | target {} ns, {:.1f}% within {:.0f}%",
+            static_cast<uint64_t>(rate), summary.minNs, summary.p1Ns, summary.p50Ns, summary.p99Ns, summary.maxNs,
+            expectedGapNs, summary.onTarget * 100, ArrivalGaps::TOLERANCE * 100);
 }
 
-int main()
+/**
+ * Blocking capture loop: every packet printed, or with `gaps` one line per
+ * second of arrivals summarising the gaps between them, timed by the
+ * capturer's own receive times (packetTimeNs()) rather than this thread's.
+ */
+template <typename Capturer>
+void capture(Capturer &capturer, bool gaps, uint64_t expectedGapNs)
 {
-    std::cout << "Starting Packet Analyzer..." << std::endl;
-    std::cout << "Device: " << CAPTURE_DEVICE << std::endl;
-    std::cout << "Filter: " << BPF_FILTER << std::endl;
+    if (!gaps)
+    {
+        capturer.startCapture(onPacketReceived);
+        return;
+    }
+    ArrivalGaps arrivals(expectedGapNs);
+    capturer.startCapture(
+        [&](const uint8_t *, size_t)
+        {
+            const int64_t arrivalNs = capturer.packetTimeNs();
+            arrivals.record(arrivalNs);
+            if (arrivals.elapsedNs(arrivalNs) >= GAP_REPORT_NS)
+                logGaps(arrivals.take(), expectedGapNs);
+        });
+}
+
+int main(int argc, char **argv)
+{
+    // --source pcap|xdp|socket: libpcap copies (default), AF_XDP takes the port's packets off the device queue
+    // (they no longer reach sockets on this host), or a UDP socket joined to --group <ip> on the device.
+    // --device <name>: interface to capture on. --gaps: per-second inter-arrival gap summary instead of the
+    // packets (pcap / socket: kernel receive times), --expect-rate <msgs/s>: share of gaps on the paced target
+    std::string_view source = "pcap";
+    std::string device = CAPTURE_DEVICE;
+    std::string group = CAPTURE_GROUP;
+    bool gaps = false;
+    uint64_t expectedGapNs = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view option = argv[i];
+        if (option == "--gaps")
+            gaps = true;
+        else if (i + 1 >= argc)
+            break;
+        else if (option == "--source")
+            source = argv[++i];
+        else if (option == "--device")
+            device = argv[++i];
+        else if (option == "--group")
+            group = argv[++i];
+        else if (option == "--expect-rate")
+        {
+            const double rate = std::atof(argv[++i]);
+            expectedGapNs = rate > 0 ? static_cast<uint64_t>(1e9 / rate) : 0;
+            gaps = true;
+        }
+    }
+
+    logInfo("Starting Packet Analyzer...");
+    logInfo("Device: {}", device);
+    logInfo("Source: {}", source);
 
     try
     {
-        PacketCapturer capturer(CAPTURE_DEVICE, BPF_FILTER);
+        if (source == "xdp")
+        {
+            if (gaps)
+            {
+                logError("--gaps needs --source pcap or socket: AF_XDP frames carry no receive time");
+                return 1;
+            }
+            XdpCapturer capturer(device, CAPTURE_PORT);
+            logInfo("Capture loop starting. Waiting for packets on udp port {}...", CAPTURE_PORT);
+            capturer.startCapture(onPacketReceived);
+            return 0;
+        }
+        if (source == "socket")
+        {
+            SocketCapturer capturer(device, group, CAPTURE_PORT);
+            logInfo("Capture loop starting. Waiting for packets on {}:{}...", group, CAPTURE_PORT);
+            capture(capturer, gaps, expectedGapNs);
+            return 0;
+        }
+
+        logInfo("Filter: {}", BPF_FILTER);
+        PacketCapturer capturer(device, BPF_FILTER, gaps);
 
-        std::cout << "Capture loop starting. Waiting for packets..." << std::endl;
+        logInfo("Capture loop starting. Waiting for packets...");
 
         // This is a blocking call. It will run forever.
-        capturer.startCapture(onPacketReceived);
+        capture(capturer, gaps, expectedGapNs);
     }
     catch (const std::exception &e)
     {
-        std::cerr << "FATAL ERROR: " << e.what() << std::endl;
+        logError("FATAL ERROR: {}", e.what());
         return 1;
     }
     return 0;
-}
\ No newline at end of file
+}
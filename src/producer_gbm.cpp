@@ -1,35 +1,66 @@
-#include <iostream>
 #include <thread>
 #include <chrono>
 #include <csignal>
 #include <atomic>
 
-#include <market/market_data_system_gbm.h>
+#include <market/market_data_engine.h>
+#include <core/blocking_ring_buffer.h>
+#include <core/async_logger.h>
+
+// Mean-reverting GBM through the mutex / condition-variable ring
+using MarketDataSystemGBM = MarketDataEngine<MeanRevertingGBMSource, BlockingRingBuffer<MarketTick, 4096>,
+                                             YieldWait, FixSnapshotEncoder, UdpTransport>;
+
+// Mean tick rate of the default Poisson arrival process (ticks / sec)
+constexpr double DEFAULT_TICK_RATE = 100.0;
 
 std::atomic<bool> keepRunning{true};
 
-void signalHandler(int signum)
+// Only flips the flag: logging is not async-signal-safe, main reports the shutdown
+void signalHandler(int)
 {
-    std::cout << "\nInterrupt signal (" << signum << ") received.\n";
     keepRunning = false;
 }
 
-int main()
+int main(int argc, char **argv)
 {
     std::signal(SIGINT, signalHandler);
     try
     {
-        MarketDataSystemGBM system;
+        // Placement flags (--pin-producer 2 --pin-consumer 3 --fifo 50 ...) come out of argv first
+        ThreadPlacement placement = ThreadPlacement::fromArgs(argc, argv);
+        // --stages 3: separate encoder and sender threads behind the queue (see PipelineMode)
+        PipelineMode mode = pipelineModeFromArgs(argc, argv);
+        // --batch N: up to N queued ticks per send call (one sendmmsg)
+        std::size_t batch = sendBatchFromArgs(argc, argv);
+        // --send-backend uring|uring-sqpoll|packet-ring|xdp: queue sends on an io_uring, a raw AF_PACKET TX ring or an AF_XDP socket instead of sendto (see UdpTransport)
+        // --gso <bytes>: send each batch as one UDP GSO write of fixed-size segments
+        // --retry spin|bounded[:N]|drop|park: what a send does when the socket is full (default park)
+        // --tx-timestamps: software TX timestamps, [Latency] txqueue = send call -> leaving the stack (socket backend)
+        // --egress-pacing txtime|etf:<msgs/s>|max-rate:<bytes/s>: the qdisc (fq / etf) spaces the datagrams, not the sender (socket backend)
+        // --line-b <ip>[:port], --line-a|b-loss <0..1>, --line-a|b-delay-us <us>: A/B lines, B (and an impaired A) sent from a thread of its own
+        TransportConfig transport = transportConfigFromArgs(argc, argv);
+        MarketDataSystemGBM system(transport);
+        // Optional arg: pacing spec (default Poisson at 100/s), e.g.
+        //   arrivals: poisson:1000 or hawkes:500:800:1000
+        //   target rate: constant:250000, step:1e5:2:5e5:2, ramp:0:1e6:10 or burst:0:2000000:10:1000
+        system.setArrivalProcess(std::make_unique<PoissonArrivalProcess>(DEFAULT_TICK_RATE));
+        if (argc > 1)
+            system.setPacing(argv[1]);
+        system.setPipelineMode(mode);
+        system.setSendBatch(batch);
+        system.setThreadPlacement(placement);
         system.start();
         while (keepRunning)
         {
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
         }
+        logInfo("Interrupt received, shutting down...");
         system.stop();
     }
     catch (const std::exception &e)
     {
-        std::cerr << "FATAL ERROR: " << e.what() << std::endl;
+        logError("FATAL ERROR: {}", e.what());
         return 1;
     }
     return 0;
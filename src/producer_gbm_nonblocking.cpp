@@ -1,11 +1,20 @@
-#include <iostream>
 #include <thread>
 #include <chrono>
+#include <string_view>
 
-#include <market/market_data_system_gbm_nonblocking.h>
+#include <market/market_data_engine.h>
+#include <core/nonblocking_ring_buffer.h>
+#include <core/async_logger.h>
 #include <csignal>
 #include <atomic>
 
+// Mean-reverting GBM through the lock-free SPSC ring
+using MarketDataSystemNonBlocking = MarketDataEngine<MeanRevertingGBMSource, LockFreeRingBuffer<MarketTick, 4096>,
+                                                     YieldWait, FixSnapshotEncoder, UdpTransport>;
+
+// Mean tick rate of the default Poisson arrival process (ticks / sec)
+constexpr double DEFAULT_TICK_RATE = 100.0;
+
 static std::atomic<bool> running{true};
 
 extern "C" void signal_handler(int)
@@ -15,13 +24,42 @@ extern "C" void signal_handler(int)
 
 int main(int argc, char **argv)
 {
-    std::cout << "Starting MarketDataSystemNonBlocking (GBM)..." << std::endl;
+    ThreadPlacement placement = ThreadPlacement::fromArgs(argc, argv);
+    // --stages 3: separate encoder and sender threads behind the queue (see PipelineMode)
+    PipelineMode mode = pipelineModeFromArgs(argc, argv);
+    // --batch N: up to N queued ticks per send call (one sendmmsg)
+    std::size_t batch = sendBatchFromArgs(argc, argv);
+    // --send-backend uring|uring-sqpoll|packet-ring|xdp: queue sends on an io_uring, a raw AF_PACKET TX ring or an AF_XDP socket instead of sendto (see UdpTransport)
+    // --gso <bytes>: send each batch as one UDP GSO write of fixed-size segments
+    // --retry spin|bounded[:N]|drop|park: what a send does when the socket is full (default park)
+    // --tx-timestamps: software TX timestamps, [Latency] txqueue = send call -> leaving the stack (socket backend)
+    // --egress-pacing txtime|etf:<msgs/s>|max-rate:<bytes/s>: the qdisc (fq / etf) spaces the datagrams, not the sender (socket backend)
+    // --line-b <ip>[:port], --line-a|b-loss <0..1>, --line-a|b-delay-us <us>: A/B lines, B (and an impaired A) sent from a thread of its own
+    TransportConfig transport = transportConfigFromArgs(argc, argv);
+    logInfo("Starting MarketDataSystemNonBlocking (GBM)...");
 
     std::signal(SIGINT, signal_handler);
     std::signal(SIGTERM, signal_handler);
 
     // Use default IP/port for simplicity
-    MarketDataSystemNonBlocking system;
+    MarketDataSystemNonBlocking system(transport);
+    system.setArrivalProcess(std::make_unique<PoissonArrivalProcess>(DEFAULT_TICK_RATE));
+    // Optional args (after any placement flags, see thread_placement.h):
+    //   <pacing spec>                                   e.g. poisson:250000, hawkes:50000:80000:100000 or constant:250000
+    //   --replay <tape> [original|fast] [ring|encoder]  replay a tape_builder file instead of generating
+    if (argc > 2 && std::string_view(argv[1]) == "--replay")
+    {
+        ReplayTiming timing = (argc > 3 && std::string_view(argv[3]) == "fast") ? ReplayTiming::AsFastAsPossible : ReplayTiming::Original;
+        ReplayTarget target = (argc > 4 && std::string_view(argv[4]) == "encoder") ? ReplayTarget::Encoder : ReplayTarget::Ring;
+        system.enableReplay(argv[2], timing, target);
+    }
+    else if (argc > 1)
+    {
+        system.setPacing(argv[1]);
+    }
+    system.setPipelineMode(mode);
+    system.setSendBatch(batch);
+    system.setThreadPlacement(placement);
     system.start();
 
     // Run until signalled to stop (Ctrl+C)
@@ -30,11 +68,11 @@ int main(int argc, char **argv)
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
 
-    std::cout << "Stopping MarketDataSystemNonBlocking..." << std::endl;
+    logInfo("Stopping MarketDataSystemNonBlocking...");
     system.stop();
     // give threads a moment to shutdown cleanly
     std::this_thread::sleep_for(std::chrono::seconds(1));
 
-    std::cout << "Shutdown complete." << std::endl;
+    logInfo("Shutdown complete.");
     return 0;
 }
@@ -0,0 +1,93 @@
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <format>
+#include <string_view>
+
+#include <market/sharded_engine.h>
+#include <core/nonblocking_ring_buffer.h>
+#include <core/async_logger.h>
+#include <csignal>
+#include <atomic>
+
+// One correlated GBM step fans out one tick per symbol through the lock-free SPSC ring
+using MarketDataShard = MarketDataEngine<CorrelatedGBMSource, LockFreeRingBuffer<MarketTick, 8192>,
+                                         YieldWait, FixSnapshotEncoder, UdpTransport>;
+// --shards N splits the universe over N such pipelines, each with its own group / port
+using MarketDataSystemMultiAsset = ShardedEngine<MarketDataShard>;
+
+static std::atomic<bool> running{true};
+
+extern "C" void signal_handler(int)
+{
+    running.store(false);
+}
+
+int main(int argc, char **argv)
+{
+    // Placement flags (--pin-producer 2 --pin-consumer 3 --fifo 50 ...) come out of argv first
+    ThreadPlacement placement = ThreadPlacement::fromArgs(argc, argv);
+    // --stages 3: separate encoder and sender threads behind the queue (see PipelineMode)
+    PipelineMode mode = pipelineModeFromArgs(argc, argv);
+    // --batch N: up to N queued ticks per send call (one sendmmsg)
+    std::size_t batch = sendBatchFromArgs(argc, argv);
+    // --send-backend uring|uring-sqpoll|packet-ring|xdp: queue sends on an io_uring, a raw AF_PACKET TX ring or an AF_XDP socket instead of sendto (see UdpTransport)
+    // --gso <bytes>: send each batch as one UDP GSO write of fixed-size segments
+    // --retry spin|bounded[:N]|drop|park: what a send does when the socket is full (default park)
+    // --tx-timestamps: software TX timestamps, [Latency] txqueue = send call -> leaving the stack (socket backend)
+    // --egress-pacing txtime|etf:<msgs/s>|max-rate:<bytes/s>: the qdisc (fq / etf) spaces the datagrams, not the sender (socket backend)
+    // --line-b <ip>[:port], --line-a|b-loss <0..1>, --line-a|b-delay-us <us>: A/B lines, B (and an impaired A) sent from a thread of its own
+    TransportConfig transport = transportConfigFromArgs(argc, argv, {"127.0.0.1", 9999});
+    //   --shards <n> [--shard-cpus <cpulist>]: shard i's producer / consumer on cpus[2i] / cpus[2i + 1]
+    //   (with --stages 3: producer / encoder / consumer on cpus[3i .. 3i + 2])
+    std::size_t shards = 1;
+    std::vector<int> shardCpus;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (arg == "--shards" && i + 1 < argc)
+            shards = std::stoul(argv[++i]);
+        else if (arg == "--shard-cpus" && i + 1 < argc)
+            shardCpus = parseCpuList(argv[++i]);
+        else
+            argv[kept++] = argv[i];
+    }
+    argc = kept;
+    // Optional args: [instruments] [rho] [pacing spec, e.g. poisson:500000 or burst:100000:2000000:10:1000]
+    std::size_t instruments = (argc > 1) ? std::stoul(argv[1]) : 500;
+    double rho = (argc > 2) ? std::stod(argv[2]) : 0.3;
+
+    logInfo("Starting MarketDataSystemMultiAsset (Correlated GBM)...");
+
+    std::signal(SIGINT, signal_handler);
+    std::signal(SIGTERM, signal_handler);
+
+    std::vector<std::string> symbols;
+    symbols.reserve(instruments);
+    for (std::size_t i = 0; i < instruments; ++i)
+    {
+        symbols.push_back(std::format("SYM{:04}", i));
+    }
+
+    MarketDataSystemMultiAsset system(symbols, ShardPartition::hash(shards), transport, rho);
+    if (argc > 3)
+        system.setPacing(argv[3]);
+    system.setPipelineMode(mode);
+    system.setSendBatch(batch);
+    system.setThreadPlacement(placement, shardCpus);
+    system.start();
+
+    // Run until signalled to stop (Ctrl+C)
+    while (running.load())
+    {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+
+    logInfo("Stopping MarketDataSystemMultiAsset...");
+    system.stop();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    logInfo("Shutdown complete.");
+    return 0;
+}
@@ -1,47 +1,69 @@
-#include <iostream>
 #include <thread>
 #include <chrono>
 #include <csignal>
 #include <atomic>
 
-// Include your Engine (Random Walk variant)
-#include <market/market_data_system_rw.h>
+#include <market/market_data_engine.h>
+#include <core/blocking_ring_buffer.h>
+#include <core/async_logger.h>
+
+// Random walk through the mutex / condition-variable ring
+using MarketDataSystemRW = MarketDataEngine<RandomWalkSource, BlockingRingBuffer<MarketTick, 4096>,
+                                            YieldWait, FixSnapshotEncoder, UdpTransport>;
 
 // Global flag for Ctrl+C handling
 std::atomic<bool> keepRunning{true};
 
-// Ctrl+C handler for graceful shutdown
-void signalHandler(int signum)
+// Ctrl+C handler for graceful shutdown (only flips the flag, logging is not async-signal-safe)
+void signalHandler(int)
 {
-    std::cout << "\nInterrupt signal (" << signum << ") received.\n";
     keepRunning = false;
 }
 
-int main()
+int main(int argc, char **argv)
 {
     // Register Ctrl+C handler
     std::signal(SIGINT, signalHandler);
 
     try
     {
-        std::cout << "Initializing Market Data System (Random Walk)..." << std::endl;
+        // Placement flags (--pin-producer 2 --pin-consumer 3 --fifo 50 ...) come out of argv first
+        ThreadPlacement placement = ThreadPlacement::fromArgs(argc, argv);
+        // --stages 3: separate encoder and sender threads behind the queue (see PipelineMode)
+        PipelineMode mode = pipelineModeFromArgs(argc, argv);
+        // --batch N: up to N queued ticks per send call (one sendmmsg)
+        std::size_t batch = sendBatchFromArgs(argc, argv);
+        // --send-backend uring|uring-sqpoll|packet-ring|xdp: queue sends on an io_uring, a raw AF_PACKET TX ring or an AF_XDP socket instead of sendto (see UdpTransport)
+        // --gso <bytes>: send each batch as one UDP GSO write of fixed-size segments
+        // --retry spin|bounded[:N]|drop|park: what a send does when the socket is full (default park)
+        // --tx-timestamps: software TX timestamps, [Latency] txqueue = send call -> leaving the stack (socket backend)
+        // --egress-pacing txtime|etf:<msgs/s>|max-rate:<bytes/s>: the qdisc (fq / etf) spaces the datagrams, not the sender (socket backend)
+        // --line-b <ip>[:port], --line-a|b-loss <0..1>, --line-a|b-delay-us <us>: A/B lines, B (and an impaired A) sent from a thread of its own
+        TransportConfig transport = transportConfigFromArgs(argc, argv);
+        logInfo("Initializing Market Data System (Random Walk)...");
 
-        MarketDataSystemRW system;
+        MarketDataSystemRW system(transport);
+        // Optional arg: pacing spec, e.g. poisson:100000 or constant:250000 (unpaced if omitted)
+        if (argc > 1)
+            system.setPacing(argv[1]);
+        system.setPipelineMode(mode);
+        system.setSendBatch(batch);
+        system.setThreadPlacement(placement);
         system.start();
 
-        std::cout << "System running. Press Ctrl+C to stop." << std::endl;
+        logInfo("System running. Press Ctrl+C to stop.");
 
         while (keepRunning)
         {
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
         }
 
-        std::cout << "Shutting down..." << std::endl;
+        logInfo("Interrupt received, shutting down...");
         system.stop();
     }
     catch (const std::exception &e)
     {
-        std::cerr << "FATAL ERROR: " << e.what() << std::endl;
+        logError("FATAL ERROR: {}", e.what());
         return 1;
     }
 
@@ -0,0 +1,184 @@
+#include <iostream>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <atomic>
+#include <algorithm>
+
+#include <market/price_generator.h>
+#include <market/geometric_brownian_motion_generator.h>
+#include <market/random_walk_generator.h>
+#include <market/heston_generator.h>
+#include <market/merton_jump_diffusion_generator.h>
+#include <market/correlated_gbm_generator.h>
+#include <market/arrival_process.h>
+#include <market/tick_tape.h>
+#include <market/parallel_tick_generator.h>
+
+using price = double;
+
+/**
+ * Offline tape builder: runs a price generator without any network / queue
+ * and writes every tick (with its arrival timestamp) to a fixed-record tape.
+ *
+ * Instruments are emitted round-robin. Scalar models (gbm, rw) get one
+ * IPriceGenerator per instrument, batch models step the whole universe
+ * every time instrument 0 comes round.
+ *
+ * The "parallel" model instead runs ParallelTickGenerator (GBM, per-instrument
+ * Poisson clocks at rate / instruments) across [workers] threads; the tape is
+ * identical for any worker count.
+ */
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output.tape> [model=gbm|rw|heston|merton|correlated|parallel]"
+                  << " [instruments=100] [ticks=1000000] [arrival=poisson:100000] [seed=42] [workers=4]" << std::endl;
+        return 1;
+    }
+
+    const std::string output = argv[1];
+    const std::string model = (argc > 2) ? argv[2] : "gbm";
+    const std::size_t instruments = (argc > 3) ? std::stoul(argv[3]) : 100;
+    const uint64_t ticks = (argc > 4) ? std::stoull(argv[4]) : 1'000'000;
+    const std::string arrivalSpec = (argc > 5) ? argv[5] : "poisson:100000";
+    const uint64_t seed = (argc > 6) ? std::stoull(argv[6]) : 42;
+    const std::size_t workers = (argc > 7) ? std::stoul(argv[7]) : 4;
+
+    try
+    {
+        // 1. Generators
+        std::vector<std::unique_ptr<IPriceGenerator<price>>> scalarGenerators;
+        std::unique_ptr<IBatchPriceGenerator<price>> batchGenerator;
+
+        if (model == "gbm")
+        {
+            for (std::size_t i = 0; i < instruments; ++i)
+                scalarGenerators.push_back(std::make_unique<GBMGenerator<price>>(100.0, 0.1, 0.3, 0.001));
+        }
+        else if (model == "rw")
+        {
+            for (std::size_t i = 0; i < instruments; ++i)
+                scalarGenerators.push_back(std::make_unique<RandomWalkGenerator<price>>(100.0, 0.01));
+        }
+        else if (model == "heston")
+        {
+            batchGenerator = std::make_unique<HestonGenerator<price>>(instruments, 100.0, HestonParameters{}, 0.001, seed);
+        }
+        else if (model == "merton")
+        {
+            batchGenerator = std::make_unique<MertonJumpDiffusionGenerator<price>>(instruments, 100.0, MertonParameters{}, 0.001, seed);
+        }
+        else if (model == "correlated")
+        {
+            batchGenerator = std::make_unique<CorrelatedGBMGenerator<price>>(instruments, 100.0, 0.1, 0.3, 0.3, 0.001, seed);
+        }
+        else if (model != "parallel")
+        {
+            std::cerr << "Unknown model: " << model << std::endl;
+            return 1;
+        }
+
+        auto arrivals = makeArrivalProcess(arrivalSpec, seed);
+
+        // 2. Symbol table
+        std::vector<std::string> symbols;
+        symbols.reserve(instruments);
+        for (std::size_t i = 0; i < instruments; ++i)
+        {
+            symbols.push_back(std::format("SYM{:04}", i));
+        }
+
+        TapeWriter writer(output, symbols, model);
+
+        if (model == "parallel")
+        {
+            ParallelGenerationConfig config;
+            config.instruments = instruments;
+            config.workers = std::min(workers, instruments);
+            config.ratePerInstrument = arrivals->meanRate() / static_cast<double>(instruments);
+            config.seed = seed;
+            ParallelTickGenerator generator{config};
+
+            // Horizon with headroom, the sink stops the run once enough ticks are written
+            std::atomic<bool> running{true};
+            const uint64_t horizonNs = static_cast<uint64_t>(2.0 * ticks / arrivals->meanRate() * 1e9) + 1'000'000'000;
+
+            uint64_t lastTimestampNs = 0;
+
+            auto t0 = std::chrono::steady_clock::now();
+            generator.run(horizonNs, [&](const TapeRecord &record)
+                          {
+                              if (writer.recordCount() >= ticks)
+                              {
+                                  running.store(false, std::memory_order_relaxed);
+                                  return;
+                              }
+                              writer.write(record);
+                              lastTimestampNs = record.timestampNs; }, running);
+            const uint64_t written = writer.recordCount();
+            writer.close();
+
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            std::cout << "Wrote " << written << " ticks (" << instruments << " symbols, model=parallel, workers=" << config.workers << ") to " << output << "\n"
+                      << "Tape duration: " << std::format("{:.3f}", lastTimestampNs / 1e9) << " s at ~" << arrivals->meanRate() << " ticks/s\n"
+                      << "Build time:    " << std::format("{:.3f}", elapsed) << " s" << std::endl;
+            return 0;
+        }
+
+        // Spread / size noise from a seeded engine so the tape is reproducible
+        std::mt19937_64 noiseEngine{seed};
+        std::uniform_real_distribution<double> spreadNoise{0.0, 0.01};
+        std::uniform_int_distribution<int32_t> sizeDistribution{50, 149};
+
+        auto t0 = std::chrono::steady_clock::now();
+        double timestampNs = 0.0;
+
+        // 3. Generate
+        for (uint64_t k = 0; k < ticks; ++k)
+        {
+            const std::size_t i = k % instruments;
+
+            price mid;
+            if (batchGenerator)
+            {
+                if (i == 0)
+                    batchGenerator->step();
+                mid = batchGenerator->prices()[i];
+            }
+            else
+            {
+                mid = scalarGenerators[i]->getNextPrice();
+            }
+
+            double spread = std::round((0.05 + spreadNoise(noiseEngine)) * 100.0) / 100.0;
+            timestampNs += arrivals->nextInterArrivalNs();
+
+            TapeRecord record{};
+            record.timestampNs = static_cast<uint64_t>(timestampNs);
+            record.symbolId = static_cast<uint32_t>(i);
+            record.bid = mid - spread / 2.0;
+            record.ask = mid + spread / 2.0;
+            record.bidSize = sizeDistribution(noiseEngine);
+            record.askSize = record.bidSize;
+            writer.write(record);
+        }
+        writer.close();
+
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::cout << "Wrote " << ticks << " ticks (" << instruments << " symbols, model=" << model << ") to " << output << "\n"
+                  << "Tape duration: " << std::format("{:.3f}", timestampNs / 1e9) << " s at ~" << arrivals->meanRate() << " ticks/s\n"
+                  << "Build time:    " << std::format("{:.3f}", elapsed) << " s" << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "FATAL ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
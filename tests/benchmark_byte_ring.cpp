@@ -0,0 +1,178 @@
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <core/byte_ring_buffer.h>
+#include <core/nonblocking_ring_buffer.h>
+#include <core/tsc_clock.h>
+#include <core/xoshiro256.h>
+
+// --- CONSTANTS ---
+const int ITERATIONS = 2'000'000;
+const std::size_t MAX_MESSAGE = 600;
+// Comparable ring memory: 1024 max-size slots (640 KB) vs a 512 KB byte ring
+const std::size_t SLOTS = 1024;
+constexpr std::size_t RING_BYTES = 512 * 1024;
+
+// Fixed-slot transfer: every message takes a max-size slot, copied in and out whole
+struct alignas(64) MessageSlot
+{
+    uint32_t size;
+    uint8_t bytes[MAX_MESSAGE];
+};
+
+// Keeps the optimiser from discarding the received bytes
+volatile uint64_t sink = 0;
+
+// What the writer "encodes": message i is sizes[i] bytes of a rolling pattern
+inline void fill(uint8_t *out, std::size_t size, int i)
+{
+    std::memset(out, 'A' + (i & 15), size);
+}
+
+inline uint64_t touch(const uint8_t *data, std::size_t size)
+{
+    return data[0] + data[size - 1] + size;
+}
+
+template <typename WriterFn, typename ReaderFn>
+double run(WriterFn &&writer, ReaderFn &&reader)
+{
+    std::atomic<bool> start{false};
+    std::thread consumer([&]()
+                         {
+        while (!start.load(std::memory_order_acquire));
+        uint64_t acc = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+            acc += reader();
+        sink = acc; });
+
+    std::thread producer([&]()
+                         {
+        while (!start.load(std::memory_order_acquire));
+        for (int i = 0; i < ITERATIONS; ++i)
+            writer(i); });
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    start.store(true, std::memory_order_release);
+    producer.join();
+    consumer.join();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return ITERATIONS / std::chrono::duration<double>(t2 - t1).count();
+}
+
+// Writer fills a local slot and pushes it (slot copy), reader pops (slot copy) and reads
+double runFixedSlots(const std::vector<uint16_t> &sizes)
+{
+    auto ring = std::make_unique<LockFreeRingBuffer<MessageSlot, SLOTS>>();
+    MessageSlot out{};
+    MessageSlot in{};
+    return run(
+        [&](int i)
+        {
+            out.size = sizes[i];
+            fill(out.bytes, out.size, i);
+            while (!ring->push(out))
+                cpuRelax();
+        },
+        [&]()
+        {
+            while (!ring->pop(in))
+                cpuRelax();
+            return touch(in.bytes, in.size);
+        });
+}
+
+// Writer fills the reservation in place, reader reads the record in place
+double runByteRing(const std::vector<uint16_t> &sizes)
+{
+    auto ring = std::make_unique<ByteRingBuffer<RING_BYTES>>();
+    return run(
+        [&](int i)
+        {
+            std::span<uint8_t> out;
+            while ((out = ring->reserve(sizes[i])).empty())
+                cpuRelax();
+            fill(out.data(), out.size(), i);
+            ring->commit(out.size());
+        },
+        [&]()
+        {
+            std::span<const uint8_t> in;
+            while ((in = ring->read()).empty())
+                cpuRelax();
+            uint64_t value = touch(in.data(), in.size());
+            ring->release();
+            return value;
+        });
+}
+
+void report(const std::string &label, const std::vector<uint16_t> &sizes)
+{
+    double meanSize = 0.0, meanRecord = 0.0;
+    for (uint16_t size : sizes)
+    {
+        meanSize += size;
+        meanRecord += ByteRingBuffer<RING_BYTES>::recordSize(size);
+    }
+    meanSize /= sizes.size();
+    meanRecord /= sizes.size();
+
+    double fixed = runFixedSlots(sizes);
+    double bytes = runByteRing(sizes);
+    std::cout << std::left << std::setw(16) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(8) << meanSize
+              << std::setw(10) << sizeof(MessageSlot)
+              << std::setw(10) << meanRecord
+              << std::setprecision(2)
+              << std::setw(12) << fixed / 1e6
+              << std::setw(12) << bytes / 1e6
+              << std::setw(12) << fixed * meanSize / 1e9
+              << std::setw(12) << bytes * meanSize / 1e9
+              << std::setw(10) << bytes / fixed << "x\n";
+}
+
+/**
+ * Moving encoded messages of 80 - 600 bytes between two threads:
+ *   fixed slots: LockFreeRingBuffer of max-size slots, whole slot copied per push / pop
+ *   byte ring:   ByteRingBuffer, written and read in place, each record only as long as its message
+ * Both rings get comparable memory; "ring B" is the ring space one message occupies.
+ */
+int main()
+{
+    std::cout << "--- BYTE RING vs FIXED-SLOT TRANSFER (SPSC, 2 threads) ---\n";
+    std::cout << "Iterations: " << ITERATIONS << " | fixed: " << SLOTS << " x " << sizeof(MessageSlot)
+              << " B slots | byte ring: " << RING_BYTES << " B\n\n";
+    std::cout << std::left << std::setw(16) << "Sizes"
+              << std::right
+              << std::setw(8) << "mean B"
+              << std::setw(10) << "slot B"
+              << std::setw(10) << "ring B"
+              << std::setw(12) << "fixed M/s"
+              << std::setw(12) << "bytes M/s"
+              << std::setw(12) << "fixed GB/s"
+              << std::setw(12) << "bytes GB/s"
+              << std::setw(11) << "speed-up" << "\n";
+    std::cout << std::string(103, '-') << "\n";
+
+    Xoshiro256PlusPlus rng(42);
+    std::vector<uint16_t> sizes(ITERATIONS);
+
+    for (uint16_t size : {80, 200, 600})
+    {
+        std::fill(sizes.begin(), sizes.end(), size);
+        report(std::to_string(size) + " B", sizes);
+    }
+    for (auto &size : sizes)
+        size = static_cast<uint16_t>(80 + rng() % (MAX_MESSAGE - 80 + 1));
+    report("80-600 B unif", sizes);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <vector>
+#include <memory>
+
+#include <market/correlated_gbm_generator.h>
+
+// --- CONSTANTS ---
+// Instrument counts to sweep: small basket -> full index universe (5,000+)
+const std::vector<std::size_t> INSTRUMENT_COUNTS = {64, 512, 2048, 5120};
+const double RHO = 0.3;
+// Minimum time spent stepping per N (keeps the large-N runs short)
+const double MIN_RUN_SECONDS = 1.0;
+
+// Keeps the optimiser from discarding the generated prices
+volatile double sink = 0.0;
+
+void run(std::size_t instruments)
+{
+    // 1. Setup cost (Cholesky factorisation happens once, in the constructor)
+    auto t0 = std::chrono::high_resolution_clock::now();
+    auto generator = std::make_unique<CorrelatedGBMGenerator<double>>(instruments, 100.0, 0.1, 0.3, RHO, 0.001, 42);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    double setupMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+    // 2. Warm up caches
+    for (int i = 0; i < 3; ++i)
+    {
+        generator->step();
+    }
+
+    // 3. Timed steps
+    uint64_t steps = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    double elapsed = 0.0;
+    while (elapsed < MIN_RUN_SECONDS)
+    {
+        generator->step();
+        sink = generator->prices()[steps % instruments];
+        ++steps;
+        elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    double nsPerStep = elapsed * 1e9 / steps;
+    double nsPerInstrumentStep = nsPerStep / instruments;
+
+    std::cout << std::left << std::setw(8) << instruments
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << setupMs
+              << std::setw(12) << steps
+              << std::setw(16) << nsPerStep
+              << std::setw(18) << nsPerInstrumentStep
+              << std::setw(16) << (instruments * steps / elapsed / 1'000'000.0) << "\n";
+}
+
+int main()
+{
+    std::cout << "--- CORRELATED GBM BENCHMARK ---\n";
+    std::cout << "rho = " << RHO << " | block = " << CorrelatedGBMGenerator<double>::BLOCK_SIZE << " columns\n\n";
+    std::cout << std::left << std::setw(8) << "N"
+              << std::right
+              << std::setw(14) << "setup (ms)"
+              << std::setw(12) << "steps"
+              << std::setw(16) << "ns/step"
+              << std::setw(18) << "ns/instr-step"
+              << std::setw(16) << "M ticks/sec" << "\n";
+
+    for (std::size_t n : INSTRUMENT_COUNTS)
+    {
+        run(n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include <core/async_logger.h>
+#include <core/metrics_registry.h>
+#include <core/tsc_clock.h>
+#include <network/transports.h>
+
+// --- CONSTANTS ---
+// Datagrams per run, and the size of each (a typical FIX snapshot)
+const int MESSAGES = 1'000'000;
+const std::size_t MESSAGE_SIZE = 120;
+// Loopback unicast so no multicast route is needed; B on a port of its own
+const TransportConfig LOOPBACK{"127.0.0.1", 9999, "127.0.0.1"};
+const char *LINE_B = "127.0.0.1";
+const uint16_t LINE_B_PORT = 9998;
+
+double threadCpuNs()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+double processCpuNs()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * MESSAGES datagrams through one UdpTransport, `batch` per call (1 =
+ * send()). Sender CPU is the publishing thread's own, i.e. what line B
+ * adds to the hot path (the copy into its ring); total CPU includes the B
+ * line thread, which sends on a core of its own in production. B sent and
+ * overrun are read once the transport is gone (its line threads drained).
+ */
+void run(const std::string &label, const TransportConfig &config, std::size_t batch)
+{
+    MetricsRegistry registry;
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'A');
+    std::vector<std::span<const uint8_t>> messages(batch, std::span<const uint8_t>(payload));
+    const std::atomic<bool> running{true};
+
+    double seconds = 0;
+    double senderCpuNs = 0;
+    double totalCpuNs = 0;
+    {
+        UdpTransport transport(config);
+        transport.bindMetrics(registry, registry.registerThread("sender"));
+
+        const double process0 = processCpuNs();
+        const double cpu0 = threadCpuNs();
+        const uint64_t t0 = readTsc();
+        for (int sent = 0; sent < MESSAGES;)
+        {
+            const std::size_t count = std::min<std::size_t>(batch, MESSAGES - sent);
+            sent += static_cast<int>(batch == 1 ? transport.send(messages[0], running)
+                                                : transport.sendBatch(std::span(messages.data(), count), running));
+        }
+        seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+        senderCpuNs = threadCpuNs() - cpu0;
+        totalCpuNs = processCpuNs() - process0;
+    }
+
+    MetricsCollector collector({&registry});
+    collector.collect();
+    std::cout << std::left << std::setw(22) << label
+              << std::setw(7) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(11) << MESSAGES / seconds / 1e6
+              << std::setprecision(0)
+              << std::setw(12) << senderCpuNs / MESSAGES
+              << std::setw(11) << totalCpuNs / MESSAGES
+              << std::setw(10) << collector.total("line_b_sent")
+              << std::setw(10) << collector.total("line_b_overrun") << "\n";
+}
+
+int main()
+{
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    TransportConfig dual = LOOPBACK;
+    dual.lineBIp = LINE_B;
+    dual.lineBPort = LINE_B_PORT;
+    TransportConfig delayed = dual;
+    delayed.lineB.delayUs = 100;
+
+    std::cout << "--- A/B LINE BENCHMARK (" << MESSAGES << " x " << MESSAGE_SIZE << " B, A "
+              << LOOPBACK.destIp << ":" << LOOPBACK.port << ", B " << LINE_B << ":" << LINE_B_PORT << ") ---\n";
+    std::cout << "Sender CPU = publishing thread per message; total = whole process (B line thread included)\n\n";
+    std::cout << std::left << std::setw(22) << "Lines"
+              << std::setw(7) << "Batch"
+              << std::right
+              << std::setw(11) << "msgs M/s"
+              << std::setw(12) << "sender ns"
+              << std::setw(11) << "total ns"
+              << std::setw(10) << "B sent"
+              << std::setw(10) << "B overrun" << "\n";
+    std::cout << std::string(83, '-') << "\n";
+    for (std::size_t batch : {1, 16})
+    {
+        run("A only", LOOPBACK, batch);
+        run("A + B", dual, batch);
+        run("A + B (B +100 us)", delayed, batch);
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <format>
+
+#include <market/market_data_engine.h>
+#include <core/blocking_ring_buffer.h>
+#include <core/nonblocking_ring_buffer.h>
+
+// --- CONSTANTS ---
+// Wall time each combination runs unpaced
+const auto RUN_TIME = std::chrono::milliseconds(500);
+const std::size_t MULTI_ASSET_INSTRUMENTS = 64;
+// Loopback unicast so the UDP rows need no multicast route
+const TransportConfig LOOPBACK{"127.0.0.1", 9999, "127.0.0.1"};
+
+template <typename... Ts>
+struct TypeList
+{
+};
+
+// Every axis of MarketDataEngine
+using Generators = TypeList<MeanRevertingGBMSource, RandomWalkSource, CorrelatedGBMSource>;
+using Queues = TypeList<BlockingRingBuffer<MarketTick, 4096>, LockFreeRingBuffer<MarketTick, 4096>>;
+using WaitStrategies = TypeList<YieldWait, SpinWait>;
+using Encoders = TypeList<FixSnapshotEncoder>;
+using Transports = TypeList<NullTransport, UdpTransport>;
+
+template <typename Queue>
+constexpr const char *queueName()
+{
+    if constexpr (requires(Queue &q) { q.stop(); })
+        return "Blocking";
+    else
+        return "LockFree";
+}
+
+template <typename Generator, typename Queue, typename Wait, typename Encoder, typename Transport>
+void run()
+{
+    using Engine = MarketDataEngine<Generator, Queue, Wait, Encoder, Transport>;
+
+    std::unique_ptr<Engine> engine;
+    if constexpr (std::is_same_v<Generator, CorrelatedGBMSource>)
+    {
+        std::vector<std::string> symbols;
+        for (std::size_t i = 0; i < MULTI_ASSET_INSTRUMENTS; ++i)
+        {
+            symbols.push_back(std::format("SYM{:04}", i));
+        }
+        engine = std::make_unique<Engine>(LOOPBACK, symbols, 0.3);
+    }
+    else
+    {
+        engine = std::make_unique<Engine>(LOOPBACK);
+    }
+    engine->setMonitorEnabled(false);
+
+    auto t0 = std::chrono::steady_clock::now();
+    engine->start();
+    std::this_thread::sleep_for(RUN_TIME);
+    uint64_t sent = engine->getSentCount();
+    uint64_t generated = engine->getGeneratedCount();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    engine->join();
+
+    std::cout << std::left << std::setw(16) << Generator::name()
+              << std::setw(10) << queueName<Queue>()
+              << std::setw(7) << Wait::name()
+              << std::setw(8) << Encoder::name()
+              << std::setw(6) << Transport::name()
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << (generated / elapsed / 1'000'000.0)
+              << std::setw(14) << (sent / elapsed / 1'000'000.0)
+              << std::setprecision(1)
+              << std::setw(12) << (sent ? elapsed * 1e9 / sent : 0.0) << "\n";
+}
+
+// Cartesian product of the five axes, one run() per combination
+template <typename G, typename Q, typename W, typename E, typename... Ts>
+void runTransports(TypeList<Ts...>) { (run<G, Q, W, E, Ts>(), ...); }
+
+template <typename G, typename Q, typename W, typename... Es>
+void runEncoders(TypeList<Es...>) { (runTransports<G, Q, W, Es>(Transports{}), ...); }
+
+template <typename G, typename Q, typename... Ws>
+void runWaits(TypeList<Ws...>) { (runEncoders<G, Q, Ws>(Encoders{}), ...); }
+
+template <typename G, typename... Qs>
+void runQueues(TypeList<Qs...>) { (runWaits<G, Qs>(WaitStrategies{}), ...); }
+
+template <typename... Gs>
+void runGenerators(TypeList<Gs...>) { (runQueues<Gs>(Queues{}), ...); }
+
+int main()
+{
+    // Engines log on construction / replay, keep the table readable
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    std::cout << "--- MARKET DATA ENGINE POLICY MATRIX ---\n";
+    std::cout << "Unpaced, " << RUN_TIME.count() << " ms per combination | UDP -> "
+              << LOOPBACK.destIp << ":" << LOOPBACK.port << "\n\n";
+
+    std::cout << std::left << std::setw(16) << "Generator"
+              << std::setw(10) << "Queue"
+              << std::setw(7) << "Wait"
+              << std::setw(8) << "Encoder"
+              << std::setw(6) << "Tx"
+              << std::right
+              << std::setw(14) << "gen M/s"
+              << std::setw(14) << "sent M/s"
+              << std::setw(12) << "ns/sent" << "\n";
+    runGenerators(Generators{});
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <core/tsc_clock.h>
+#include <core/async_logger.h>
+#include <network/udp_sender.h>
+
+#include <netinet/in.h>
+
+// --- CONSTANTS ---
+// Datagrams per run, and the size of each message (a typical FIX snapshot)
+const int PACKETS = 2'000'000;
+const std::size_t MESSAGE_SIZE = 120;
+// Loopback unicast so no multicast route is needed
+const char *DEST_IP = "127.0.0.1";
+const uint16_t PORT = 9999;
+
+double threadCpuNs()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * PACKETS datagrams of MESSAGE_SIZE bytes, `batch` per call:
+ *   batch 1:        send(), one sendto per packet
+ *   batch N:        sendBatch(), one sendmmsg per N packets
+ *   batch N + GSO:  sendBatch(), one sendmsg of N segments the kernel splits
+ * Packets/s is wall time of the sending thread, CPU per packet its own CPU
+ * time (the loopback receive path runs in the same context, so it counts).
+ */
+void run(const std::string &label, std::size_t batch, uint16_t gsoSegment)
+{
+    UDPMulticastSender sender(DEST_IP, PORT, "127.0.0.1");
+    if (gsoSegment > 0 && !sender.enableGso(gsoSegment))
+    {
+        std::cout << std::left << std::setw(16) << label << "UDP GSO not supported by this kernel\n";
+        return;
+    }
+
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'A');
+    std::vector<std::span<const uint8_t>> messages(batch, std::span<const uint8_t>(payload));
+
+    uint64_t calls = 0;
+    uint64_t full = 0;
+    const double cpu0 = threadCpuNs();
+    const uint64_t t0 = readTsc();
+    for (int sent = 0; sent < PACKETS;)
+    {
+        const std::size_t count = std::min<std::size_t>(batch, PACKETS - sent);
+        const std::size_t went = batch == 1 ? (sender.send(messages[0]) == SendStatus::Sent)
+                                            : sender.sendBatch(std::span(messages.data(), count)).sent;
+        ++calls;
+        if (went == 0)
+        {
+            ++full;
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+        }
+        sent += static_cast<int>(went);
+    }
+    const double seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+    const double cpuNs = threadCpuNs() - cpu0;
+    // A GSO write the kernel rejected switches itself off mid-run
+    const bool segmented = gsoSegment > 0 && sender.gsoSegment() > 0;
+
+    std::cout << std::left << std::setw(16) << label
+              << std::setw(7) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(11) << PACKETS / seconds / 1e6
+              << std::setprecision(0)
+              << std::setw(10) << cpuNs / PACKETS
+              << std::setprecision(4)
+              << std::setw(11) << static_cast<double>(calls) / PACKETS
+              << std::setprecision(0)
+              << std::setw(8) << (segmented ? gsoSegment : MESSAGE_SIZE)
+              << std::setw(8) << full
+              << (gsoSegment > 0 && !segmented ? "  (fell back to sendmmsg)" : "") << "\n";
+}
+
+/**
+ * Bound but never read: without a socket on the port loopback drops a GSO
+ * write whole, before it is cut into datagrams. With one, every write is
+ * segmented and each datagram is delivered (or dropped at the full queue)
+ * on its own, so all paths pay per packet.
+ */
+int bindSink()
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0)
+    {
+        std::cerr << "Could not bind a sink on port " << PORT << ": " << std::strerror(errno) << "\n";
+        return -1;
+    }
+    return fd;
+}
+
+int main()
+{
+    // Fallback warnings only
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+    int sink = bindSink();
+    if (sink < 0)
+        return 1;
+
+    std::cout << "--- UDP GSO BENCHMARK (sendto / sendmmsg / UDP_SEGMENT) ---\n";
+    std::cout << PACKETS << " packets of " << MESSAGE_SIZE << " B -> " << DEST_IP << ":" << PORT
+              << " (bound, unread sink) | CPU = sending thread, wire B = datagram size incl. padding\n\n";
+    std::cout << std::left << std::setw(16) << "Path"
+              << std::setw(7) << "Batch"
+              << std::right
+              << std::setw(11) << "pkts M/s"
+              << std::setw(10) << "CPU ns"
+              << std::setw(11) << "calls/pkt"
+              << std::setw(8) << "wire B"
+              << std::setw(8) << "full" << "\n";
+    std::cout << std::string(71, '-') << "\n";
+
+    run("sendto", 1, 0);
+    run("sendmmsg", 16, 0);
+    run("sendmmsg", 64, 0);
+    // Exact segments: no padding
+    run("GSO 120", 16, 120);
+    run("GSO 120", 64, 120);
+    // Segment above the message size: 8 B of padding per datagram
+    run("GSO 128 padded", 16, 128);
+    run("GSO 128 padded", 64, 128);
+    close(sink);
+    return 0;
+}
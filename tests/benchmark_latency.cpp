@@ -24,6 +24,7 @@ inline uint64_t __rdtsc()
 
 #include "../include/core/blocking_ring_buffer.h"
 #include "../include/core/nonblocking_ring_buffer.h"
+#include "../include/core/thread_placement.h"
 
 // --- CONSTANTS ---
 // Estimated nanoseconds per cycle for a 3.2GHz CPU (M1/M2/M3 Performance Core)
@@ -86,7 +87,7 @@ void print_detailed_stats(const std::string &label, std::vector<uint64_t> &data)
 }
 
 // --- NON-BLOCKING LATENCY TEST ---
-void test_nonblocking(size_t iterations)
+void test_nonblocking(size_t iterations, const ThreadRole &consumerRole)
 {
     auto q = std::make_unique<LockFreeRingBuffer<Tick, 65536>>();
     std::vector<uint64_t> latencies;
@@ -97,6 +98,7 @@ void test_nonblocking(size_t iterations)
     // Consumer
     std::thread consumer([&]()
                          {
+        applyThreadPlacement("lat-consumer", consumerRole);
         Tick t;
         while (running.load(std::memory_order_relaxed)) {
             if (q->pop(t)) {
@@ -129,7 +131,7 @@ void test_nonblocking(size_t iterations)
 }
 
 // --- BLOCKING LATENCY TEST ---
-void test_blocking(size_t iterations)
+void test_blocking(size_t iterations, const ThreadRole &consumerRole)
 {
     auto q = std::make_unique<BlockingRingBuffer<Tick, 65536>>();
     std::vector<uint64_t> latencies;
@@ -140,6 +142,7 @@ void test_blocking(size_t iterations)
     // Consumer
     std::thread consumer([&]()
                          {
+        applyThreadPlacement("lat-consumer", consumerRole);
         Tick t;
         while (running.load(std::memory_order_relaxed)) {
             if (q->pop(t)) {
@@ -168,8 +171,24 @@ void test_blocking(size_t iterations)
     print_detailed_stats("Blocking (Mutex/CondVar) Stats", latencies);
 }
 
-int main()
+// Optional args: thread placement flags (thread_placement.h), e.g.
+//   --pin-producer 2 --pin-consumer 3 --fifo 50 --require-isolated
+// The producer role is the main thread.
+int main(int argc, char **argv)
 {
+    ThreadPlacement placement;
+    try
+    {
+        placement = ThreadPlacement::fromArgs(argc, argv);
+        checkThreadPlacement("producer", placement.producer, placement.requireIsolated);
+        checkThreadPlacement("consumer", placement.consumer, placement.requireIsolated);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
     std::cout << "==================================================\n";
     std::cout << "   LATENCY & JITTER BENCHMARK (Lower is Better)   \n";
     std::cout << "==================================================\n";
@@ -184,8 +203,9 @@ int main()
               << "\n";
     std::cout << "Clock est:    " << (1.0 / NS_PER_CYCLE) << " GHz\n\n";
 
-    test_blocking(100000);
-    test_nonblocking(100000);
+    applyThreadPlacement("lat-producer", placement.producer);
+    test_blocking(100000, placement.consumer);
+    test_nonblocking(100000, placement.consumer);
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <core/tsc_clock.h>
+#include <core/async_logger.h>
+
+// --- CONSTANTS ---
+// Lines per burst: fits the per-thread log ring, the logger drains between bursts
+const int BURST = 500;
+const int BURSTS = 200;
+
+/**
+ * Caller-side cost of one "[Rate] ..." style line (string + 3 numbers):
+ *  - logInfo:        binary record into the thread's ring, formatted elsewhere
+ *  - std::format:    formatted on the caller into a string, then fwrite
+ *  - ofstream+endl:  operator<< chain and a flush per line (the old std::cout path)
+ * Output goes to /dev/null so the terminal does not dominate. Returns the
+ * sorted per-call latencies in ns as seen by the logging thread.
+ */
+template <typename Fn>
+std::vector<double> measure(Fn &&logOne)
+{
+    std::vector<double> ns;
+    ns.reserve(BURST * BURSTS);
+    for (int b = 0; b < BURSTS; ++b)
+    {
+        for (int i = 0; i < BURST; ++i)
+        {
+            uint64_t t0 = TscClock::now();
+            logOne(i);
+            ns.push_back(TscClock::toNs(TscClock::now() - t0));
+        }
+        AsyncLogger::instance().flush();
+    }
+
+    std::sort(ns.begin(), ns.end());
+    return ns;
+}
+
+void report(const std::string &label, const std::vector<double> &ns)
+{
+    std::cout << std::left << std::setw(18) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << ns[ns.size() / 2]
+              << std::setw(12) << ns[static_cast<size_t>(ns.size() * 0.99)]
+              << std::setw(12) << ns[static_cast<size_t>(ns.size() * 0.999)]
+              << std::setw(14) << ns.back() << "\n";
+}
+
+int main()
+{
+    std::cout << "--- ASYNC LOGGER BENCHMARK (caller-side ns per line) ---\n";
+    std::cout << BURSTS << " bursts of " << BURST << " lines, output to /dev/null\n\n";
+    std::cout << std::left << std::setw(18) << "Path"
+              << std::right
+              << std::setw(12) << "p50"
+              << std::setw(12) << "p99"
+              << std::setw(12) << "p99.9"
+              << std::setw(14) << "max" << "\n";
+    std::cout << std::string(68, '-') << std::endl;
+
+    const std::string symbol = "SYM0042";
+    double price = 101.25;
+
+    // The logger writes stdout: point fd 1 at /dev/null while it runs, keep the table on the terminal
+    int table = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    auto async = measure([&](int i)
+                         { logInfo("[Rate] {} Target = {}/s, Achieved = {:.1f}/s", symbol, i, price); });
+    AsyncLogger::instance().flush();
+    std::fflush(stdout);
+    dup2(table, STDOUT_FILENO);
+    close(table);
+    report("logInfo", async);
+
+    std::FILE *sink = std::fopen("/dev/null", "w");
+    report("std::format", measure([&](int i)
+                                  {
+        std::string line = std::format("[Rate] {} Target = {}/s, Achieved = {:.1f}/s\n", symbol, i, price);
+        std::fwrite(line.data(), 1, line.size(), sink);
+        std::fflush(sink); }));
+    std::fclose(sink);
+
+    std::ofstream stream("/dev/null");
+    report("ofstream+endl", measure([&](int i)
+                                    { stream << "[Rate] " << symbol << " Target = " << i << "/s, Achieved = "
+                                             << std::fixed << std::setprecision(1) << price << "/s" << std::endl; }));
+
+    close(devNull);
+    return 0;
+}
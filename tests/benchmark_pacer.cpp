@@ -0,0 +1,98 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <cmath>
+
+#include <core/tsc_clock.h>
+#include <core/tsc_pacer.h>
+#include <market/arrival_process.h>
+
+// --- CONSTANTS ---
+// Each run lasts roughly this long regardless of rate
+const double RUN_SECONDS = 0.5;
+// Window used to measure burstiness (count dispersion)
+const double WINDOW_NS = 1'000'000.0; // 1ms
+
+/**
+ * Releases events from the arrival process with a TscPacer and reports:
+ *  - achieved vs target rate
+ *  - release error (actual TSC at release - scheduled deadline)
+ *  - index of dispersion of counts per 1ms window (1 = Poisson, >1 = bursty)
+ */
+void run(const std::string &label, std::unique_ptr<IArrivalProcess> arrivals)
+{
+    const double target = arrivals->meanRate();
+    const size_t events = std::max<size_t>(50, static_cast<size_t>(target * RUN_SECONDS));
+
+    std::vector<double> lateness;
+    lateness.reserve(events);
+    std::vector<double> releaseNs;
+    releaseNs.reserve(events);
+
+    TscPacer pacer;
+    uint64_t start = TscClock::now();
+    for (size_t i = 0; i < events; ++i)
+    {
+        lateness.push_back(pacer.wait(arrivals->nextInterArrivalNs()));
+        releaseNs.push_back(TscClock::toNs(TscClock::now() - start));
+    }
+    double elapsedNs = TscClock::toNs(TscClock::now() - start);
+
+    // Counts per window -> variance / mean
+    std::vector<double> counts(static_cast<size_t>(elapsedNs / WINDOW_NS) + 1, 0.0);
+    for (double t : releaseNs)
+    {
+        counts[static_cast<size_t>(t / WINDOW_NS)] += 1.0;
+    }
+    double mean = 0.0, var = 0.0;
+    for (double c : counts)
+        mean += c;
+    mean /= counts.size();
+    for (double c : counts)
+        var += (c - mean) * (c - mean);
+    var /= counts.size();
+
+    std::sort(lateness.begin(), lateness.end());
+    double p50 = lateness[lateness.size() / 2];
+    double p99 = lateness[static_cast<size_t>(lateness.size() * 0.99)];
+
+    std::cout << std::left << std::setw(28) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << target
+              << std::setw(12) << (events / (elapsedNs / 1e9))
+              << std::setprecision(1)
+              << std::setw(12) << p50
+              << std::setw(12) << p99
+              << std::setw(12) << lateness.back()
+              << std::setprecision(2)
+              << std::setw(12) << (mean > 0 ? var / mean : 0.0) << "\n";
+}
+
+int main()
+{
+    std::cout << "--- ARRIVAL PROCESS / TSC PACER BENCHMARK ---\n";
+    std::cout << "TSC rate: " << std::setprecision(3) << TscClock::ticksPerNs() << " ticks/ns | release lateness in ns\n\n";
+    std::cout << std::left << std::setw(28) << "Process"
+              << std::right
+              << std::setw(12) << "target/s"
+              << std::setw(12) << "achieved/s"
+              << std::setw(12) << "late p50"
+              << std::setw(12) << "late p99"
+              << std::setw(12) << "late max"
+              << std::setw(12) << "disp(1ms)" << "\n";
+
+    run("Poisson 100/s", std::make_unique<PoissonArrivalProcess>(100.0, 1));
+    run("Poisson 10k/s", std::make_unique<PoissonArrivalProcess>(10'000.0, 1));
+    run("Poisson 250k/s", std::make_unique<PoissonArrivalProcess>(250'000.0, 1));
+    run("Poisson 1M/s", std::make_unique<PoissonArrivalProcess>(1'000'000.0, 1));
+    run("Poisson 4M/s", std::make_unique<PoissonArrivalProcess>(4'000'000.0, 1));
+
+    // Same mean rates, clustered: alpha/beta = 0.8 -> mean = 5 * mu
+    run("Hawkes mean 10k/s", std::make_unique<HawkesArrivalProcess>(2'000.0, 8'000.0, 10'000.0, 1));
+    run("Hawkes mean 1M/s", std::make_unique<HawkesArrivalProcess>(200'000.0, 800'000.0, 1'000'000.0, 1));
+
+    return 0;
+}
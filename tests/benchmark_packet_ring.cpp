@@ -0,0 +1,180 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <core/tsc_clock.h>
+#include <core/async_logger.h>
+#include <network/packet_ring_sender.h>
+#include <network/udp_sender.h>
+
+#include <netinet/in.h>
+
+// --- CONSTANTS ---
+// Datagrams per run, and the size of each (a typical FIX snapshot)
+const int PACKETS = 2'000'000;
+const std::size_t MESSAGE_SIZE = 120;
+const uint16_t PORT = 9999;
+// Datagrams the delivery check sends through the ring before timing anything
+const int CHECK_PACKETS = 64;
+
+double threadCpuNs()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * PACKETS datagrams through `sender`, `batch` per call (1 = send()).
+ * Packets/s is wall time of the sending thread, CPU per packet its own CPU
+ * time (on loopback / veth the receive path runs in the same context, so it
+ * counts). `systemCalls` reports a sender's own call count (empty = one per
+ * call), `drops` frames the device refused after they were accepted.
+ */
+template <typename Sender>
+void run(const std::string &label, Sender &sender, std::size_t batch, const std::function<uint64_t()> &systemCalls,
+         const std::function<uint64_t()> &drops)
+{
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'A');
+    std::vector<std::span<const uint8_t>> messages(batch, std::span<const uint8_t>(payload));
+
+    uint64_t calls = 0;
+    uint64_t full = 0;
+    const uint64_t calls0 = systemCalls ? systemCalls() : 0;
+    const uint64_t drops0 = drops ? drops() : 0;
+    const double cpu0 = threadCpuNs();
+    const uint64_t t0 = readTsc();
+    for (int sent = 0; sent < PACKETS;)
+    {
+        const std::size_t count = std::min<std::size_t>(batch, PACKETS - sent);
+        const std::size_t went = batch == 1 ? (sender.send(messages[0]) == SendStatus::Sent)
+                                            : sender.sendBatch(std::span(messages.data(), count)).sent;
+        ++calls;
+        if (went == 0)
+        {
+            // Socket buffer full / every ring frame still queued
+            ++full;
+            sender.waitWritable(1);
+        }
+        sent += static_cast<int>(went);
+    }
+    const double seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+    const double cpuNs = threadCpuNs() - cpu0;
+    const uint64_t syscalls = systemCalls ? systemCalls() - calls0 : calls;
+
+    std::cout << std::left << std::setw(14) << label
+              << std::setw(7) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(11) << PACKETS / seconds / 1e6
+              << std::setprecision(0)
+              << std::setw(10) << cpuNs / PACKETS
+              << std::setprecision(4)
+              << std::setw(11) << static_cast<double>(syscalls) / PACKETS
+              << std::setprecision(0)
+              << std::setw(9) << full
+              << std::setw(9) << (drops ? drops() - drops0 : 0) << "\n";
+}
+
+/**
+ * Bound on the destination so the datagrams have somewhere to go. Read only
+ * by the delivery check; during the timed runs it fills and the kernel drops
+ * the rest at its queue, as for every path.
+ */
+int bindSink(const std::string &destIp)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(PORT);
+    inet_pton(AF_INET, destIp.c_str(), &addr.sin_addr);
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0)
+    {
+        std::cerr << "Could not bind a sink on " << destIp << ":" << PORT << ": " << std::strerror(errno) << "\n";
+        return -1;
+    }
+    timeval timeout{0, 200'000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+// The hand-built frames must reach a UDP socket intact, otherwise packets/s means nothing
+bool deliveryCheck(PacketRingSender &ring, int sink)
+{
+    std::vector<uint8_t> payload(MESSAGE_SIZE);
+    for (int i = 0; i < CHECK_PACKETS; ++i)
+    {
+        std::fill(payload.begin(), payload.end(), static_cast<uint8_t>(i));
+        while (ring.send(payload) != SendStatus::Sent)
+            ring.waitWritable(1);
+    }
+    int received = 0;
+    std::vector<uint8_t> buffer(2048);
+    for (;;)
+    {
+        const ssize_t size = recv(sink, buffer.data(), buffer.size(), 0);
+        if (size < 0)
+            break;
+        if (static_cast<std::size_t>(size) == MESSAGE_SIZE && buffer[0] == received && buffer[MESSAGE_SIZE - 1] == received)
+            ++received;
+    }
+    std::cout << "Delivery check: " << received << "/" << CHECK_PACKETS << " ring datagrams received intact\n";
+    return received == CHECK_PACKETS;
+}
+
+int main(int argc, char **argv)
+{
+    // <interface ip> <destination ip>: e.g. one end of a veth pair and the other
+    const std::string interfaceIp = argc > 1 ? argv[1] : "127.0.0.1";
+    const std::string destIp = argc > 2 ? argv[2] : interfaceIp;
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    int sink = bindSink(destIp);
+    if (sink < 0)
+        return 1;
+
+    std::cout << "--- PACKET TX RING BENCHMARK (sendto / sendmmsg / AF_PACKET TPACKET_V3) ---\n";
+    std::unique_ptr<PacketRingSender> ring;
+    try
+    {
+        ring = std::make_unique<PacketRingSender>(destIp, PORT, interfaceIp);
+        if (!deliveryCheck(*ring, sink))
+            std::cout << "  frames are not delivered: same-host test beds need accept_local on the receiving "
+                         "interface (loopback: also route_localnet), see README\n";
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "Packet TX ring unavailable: " << e.what() << " (needs CAP_NET_RAW)\n";
+    }
+
+    std::cout << "\n" << PACKETS << " packets of " << MESSAGE_SIZE << " B, " << interfaceIp << " -> " << destIp << ":"
+              << PORT << " | CPU = sending thread, syscalls per packet\n\n";
+    std::cout << std::left << std::setw(14) << "Path"
+              << std::setw(7) << "Batch"
+              << std::right
+              << std::setw(11) << "pkts M/s"
+              << std::setw(10) << "CPU ns"
+              << std::setw(11) << "syscalls"
+              << std::setw(9) << "full"
+              << std::setw(9) << "dropped" << "\n";
+    std::cout << std::string(71, '-') << "\n";
+
+    for (std::size_t batch : {1, 16, 64})
+    {
+        UDPMulticastSender sender(destIp, PORT, interfaceIp);
+        run(batch == 1 ? "sendto" : "sendmmsg", sender, batch, {}, {});
+    }
+    if (ring)
+    {
+        for (std::size_t batch : {1, 16, 64})
+            run("packet ring", *ring, batch, [&] { return ring->flushCalls(); }, [&] { return ring->deviceDrops(); });
+    }
+    close(sink);
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <thread>
+
+#include <market/market_data_engine.h>
+#include <core/nonblocking_ring_buffer.h>
+
+// --- CONSTANTS ---
+// Wall time of each run
+const auto RUN_TIME = std::chrono::milliseconds(1000);
+// Paced rows: low enough that queues stay short, so latency is the pipeline's own
+const char *PACED = "constant:100000";
+// Loopback unicast so the UDP rows need no multicast route
+const TransportConfig LOOPBACK{"127.0.0.1", 9999, "127.0.0.1"};
+
+template <typename Transport>
+using Engine = MarketDataEngine<RandomWalkSource, LockFreeRingBuffer<MarketTick, 4096>,
+                                YieldWait, FixSnapshotEncoder, Transport>;
+
+/**
+ * One engine run: sent rate, end-to-end (generated -> send return) latency
+ * and the busy share of each thread, two-stage vs three-stage.
+ * Unpaced rows show the throughput ceiling (latency is then mostly queue
+ * residence), paced rows the latency at a rate both layouts sustain.
+ */
+template <typename Transport>
+void run(PipelineMode mode, const char *pacing, const ThreadPlacement &placement)
+{
+    Engine<Transport> engine(LOOPBACK);
+    engine.setMonitorEnabled(false);
+    engine.setPipelineMode(mode);
+    engine.setThreadPlacement(placement);
+    if (pacing)
+        engine.setPacing(pacing);
+
+    MetricsCollector collector({&engine.metrics()});
+    engine.start();
+    collector.collect();
+    const uint64_t t0 = readTsc();
+    std::this_thread::sleep_for(RUN_TIME);
+    collector.collect();
+    const double elapsedTsc = static_cast<double>(readTsc() - t0);
+    engine.join();
+
+    const bool threeStage = mode == PipelineMode::ThreeStage;
+    auto busy = [&](const char *counter)
+    { return 100.0 * static_cast<double>(collector.delta(counter)) / elapsedTsc; };
+    LatencySummary total = collector.histogram("latency.total");
+
+    std::cout << std::left << std::setw(8) << (threeStage ? "3-stage" : "2-stage")
+              << std::setw(6) << Transport::name()
+              << std::setw(18) << (pacing ? pacing : "unpaced")
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(10) << (collector.delta("ticks_sent") / TscClock::toNs(static_cast<uint64_t>(elapsedTsc)) * 1e3)
+              << std::setprecision(0)
+              << std::setw(12) << TscClock::toNs(total.p50)
+              << std::setw(12) << TscClock::toNs(total.p99)
+              << std::setprecision(1)
+              << std::setw(9) << busy("busy_tsc.producer")
+              << std::setw(9) << (threeStage ? busy("busy_tsc.encoder") : 0.0)
+              << std::setw(9) << busy("busy_tsc.consumer") << "\n";
+}
+
+int main(int argc, char **argv)
+{
+    // --pin-producer / --pin-encoder / --pin-consumer apply to every run
+    ThreadPlacement placement;
+    try
+    {
+        placement = ThreadPlacement::fromArgs(argc, argv);
+        checkThreadPlacement(placement, true);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    // Engines log on construction, keep the table readable
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    std::cout << "--- PIPELINE STAGES BENCHMARK (2-stage vs 3-stage) ---\n";
+    std::cout << RUN_TIME.count() << " ms per run | UDP -> " << LOOPBACK.destIp << ":" << LOOPBACK.port
+              << " | latency = generated -> send return, busy = % of wall time per thread\n\n";
+    std::cout << std::left << std::setw(8) << "Layout"
+              << std::setw(6) << "Tx"
+              << std::setw(18) << "Pacing"
+              << std::right
+              << std::setw(10) << "sent M/s"
+              << std::setw(12) << "p50 ns"
+              << std::setw(12) << "p99 ns"
+              << std::setw(9) << "prod%"
+              << std::setw(9) << "enc%"
+              << std::setw(9) << "send%" << "\n";
+    std::cout << std::string(93, '-') << "\n";
+
+    for (const char *pacing : {static_cast<const char *>(nullptr), PACED})
+    {
+        for (PipelineMode mode : {PipelineMode::TwoStage, PipelineMode::ThreeStage})
+        {
+            run<NullTransport>(mode, pacing, placement);
+            run<UdpTransport>(mode, pacing, placement);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <string>
+#include <functional>
+#include <cmath>
+
+#include <market/geometric_brownian_motion_generator.h>
+#include <market/heston_generator.h>
+#include <market/merton_jump_diffusion_generator.h>
+
+// --- CONSTANTS ---
+const std::vector<std::size_t> INSTRUMENT_COUNTS = {1024, 8192};
+const double DT = 0.001;
+const double MIN_RUN_SECONDS = 1.0;
+
+// Keeps the optimiser from discarding the generated prices
+volatile double sink = 0.0;
+
+/**
+ * Runs stepFn (one step of every instrument) for MIN_RUN_SECONDS and
+ * prints ns/step and ns/instrument-step.
+ */
+void run(const std::string &label, std::size_t instruments, const std::function<void()> &stepFn)
+{
+    // Warm up caches
+    for (int i = 0; i < 10; ++i)
+    {
+        stepFn();
+    }
+
+    uint64_t steps = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    double elapsed = 0.0;
+    while (elapsed < MIN_RUN_SECONDS)
+    {
+        stepFn();
+        ++steps;
+        elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    double nsPerStep = elapsed * 1e9 / steps;
+    std::cout << std::left << std::setw(24) << label
+              << std::right << std::setw(8) << instruments
+              << std::fixed << std::setprecision(1)
+              << std::setw(16) << nsPerStep
+              << std::setw(18) << nsPerStep / instruments
+              << std::setw(14) << (instruments * steps / elapsed / 1'000'000.0) << "\n";
+}
+
+int main()
+{
+    std::cout << "--- PRICE MODEL BENCHMARK (dt = " << DT << ") ---\n\n";
+    std::cout << std::left << std::setw(24) << "Model"
+              << std::right << std::setw(8) << "N"
+              << std::setw(16) << "ns/step"
+              << std::setw(18) << "ns/instr-step"
+              << std::setw(14) << "M prices/s" << "\n";
+
+    for (std::size_t n : INSTRUMENT_COUNTS)
+    {
+        // 1. Baseline: one scalar GBMGenerator per instrument (virtual call each)
+        std::vector<std::unique_ptr<IPriceGenerator<double>>> gbms;
+        gbms.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            gbms.push_back(std::make_unique<GBMGenerator<double>>(100.0, 0.05, 0.2, DT));
+        }
+        run("GBM (scalar x N)", n, [&]
+            {
+            for (auto &g : gbms) {
+                sink = g->getNextPrice();
+            } });
+
+        // 2. Heston stochastic volatility (batched)
+        HestonGenerator<double> heston(n, 100.0, HestonParameters{}, DT, 42);
+        run("Heston (batch)", n, [&]
+            {
+            heston.step();
+            sink = heston.prices()[0]; });
+
+        // 3. Merton jump diffusion (batched)
+        MertonJumpDiffusionGenerator<double> merton(n, 100.0, MertonParameters{}, DT, 42);
+        uint64_t jumps = 0;
+        uint64_t mertonSteps = 0;
+        run("Merton (batch)", n, [&]
+            {
+            merton.step();
+            for (uint32_t j : merton.jumpCounts()) {
+                jumps += j;
+            }
+            ++mertonSteps; });
+
+        std::cout << "    Merton jumps / instrument-step = " << std::setprecision(4)
+                  << static_cast<double>(jumps) / (mertonSteps * n)
+                  << " (expected " << MertonParameters{}.lambda * DT << ")\n\n";
+    }
+
+    return 0;
+}
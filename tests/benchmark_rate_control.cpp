@@ -0,0 +1,74 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <core/tsc_clock.h>
+#include <core/rate_controller.h>
+
+// --- CONSTANTS ---
+// Monitor window, same cadence as the engine's [Rate] line but shorter so runs stay quick
+const double WINDOW_NS = 100'000'000.0; // 100ms
+const int WINDOWS = 10;
+
+/**
+ * Releases messages from a RateController for WINDOWS monitor windows and,
+ * per window, prints target vs achieved rate and the schedule lag.
+ * Summary: worst relative rate error and lag percentiles over the whole run.
+ */
+void run(const std::string &spec)
+{
+    RateController controller(makeRateProfile(spec));
+    std::vector<double> lags;
+
+    std::cout << spec << "\n";
+
+    double worstError = 0.0;
+    uint64_t start = TscClock::now();
+    uint64_t windowEnd = start + TscClock::fromNs(WINDOW_NS);
+    controller.sample(); // Open the first window
+
+    for (int window = 0; window < WINDOWS; ++window)
+    {
+        while (TscClock::now() < windowEnd)
+        {
+            lags.push_back(controller.acquire());
+        }
+        windowEnd += TscClock::fromNs(WINDOW_NS);
+
+        RateSample sample = controller.sample();
+        double error = sample.targetRate > 0 ? std::abs(sample.achievedRate - sample.targetRate) / sample.targetRate : 0.0;
+        worstError = std::max(worstError, error);
+
+        std::cout << std::fixed << std::setprecision(0)
+                  << "  t=" << std::setw(5) << (window + 1) * WINDOW_NS / 1e6 << "ms"
+                  << "  target " << std::setw(10) << sample.targetRate << "/s"
+                  << "  achieved " << std::setw(10) << sample.achievedRate << "/s"
+                  << std::setprecision(1)
+                  << "  lag " << std::setw(8) << sample.lagNs / 1000.0 << "us"
+                  << "  max " << std::setw(8) << sample.maxLagNs / 1000.0 << "us\n";
+    }
+
+    std::sort(lags.begin(), lags.end());
+    std::cout << "  -> " << lags.size() << " releases, worst window error " << std::setprecision(2) << worstError * 100.0 << "%"
+              << std::setprecision(0)
+              << ", lag p50 " << lags[lags.size() / 2] << "ns"
+              << ", p99 " << lags[static_cast<size_t>(lags.size() * 0.99)] << "ns"
+              << ", max " << lags.back() << "ns\n\n";
+}
+
+int main()
+{
+    std::cout << "--- RATE CONTROLLER BENCHMARK ---\n";
+    std::cout << "TSC rate: " << std::setprecision(3) << TscClock::ticksPerNs() << " ticks/ns | "
+              << WINDOWS << " windows of " << WINDOW_NS / 1e6 << "ms per profile\n\n";
+
+    run("constant:250000");
+    run("step:100000:0.3:500000:0.3:1000000:0.4");
+    run("ramp:0:2000000:1");
+    // 10ms at 2M/s every 100ms on a 50k/s floor (windows line up with the period)
+    run("burst:50000:2000000:10:100");
+
+    return 0;
+}
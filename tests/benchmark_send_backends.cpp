@@ -0,0 +1,135 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <core/tsc_clock.h>
+#include <network/transports.h>
+
+// --- CONSTANTS ---
+// Datagrams per run, and the size of each (a typical FIX snapshot)
+const int MESSAGES = 1'000'000;
+const std::size_t MESSAGE_SIZE = 120;
+const std::size_t BATCHES[] = {1, 16, 64};
+// Loopback unicast so no multicast route is needed
+const TransportConfig LOOPBACK{"127.0.0.1", 9999, "127.0.0.1"};
+
+double threadCpuNs()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * MESSAGES datagrams through `sender`, `batch` per call (1 = send()).
+ * Latency is per call: how long the sending thread is held by it. CPU is
+ * the sending thread's own; an SQPOLL kernel thread is not included.
+ * Returns once everything has been handed over (io_uring: completed).
+ * `submitCalls` counts a backend's own system calls (empty = one per call).
+ */
+template <typename Sender>
+void run(const std::string &label, Sender &sender, std::size_t batch, const std::function<void()> &drain,
+         const std::function<uint64_t()> &submitCalls)
+{
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'A');
+    std::vector<std::span<const uint8_t>> messages(batch, std::span<const uint8_t>(payload));
+    std::vector<uint64_t> callTsc;
+    callTsc.reserve(MESSAGES);
+
+    uint64_t full = 0;
+    uint64_t socketCalls = 0;
+    const double cpu0 = threadCpuNs();
+    const uint64_t t0 = readTsc();
+    for (int sent = 0; sent < MESSAGES;)
+    {
+        const std::size_t count = std::min<std::size_t>(batch, MESSAGES - sent);
+        const uint64_t callStart = readTsc();
+        const std::size_t went = batch == 1 ? (sender.send(messages[0]) == SendStatus::Sent)
+                                            : sender.sendBatch(std::span(messages.data(), count)).sent;
+        ++socketCalls;
+        if (went == 0)
+        {
+            // Socket buffer full / every slot in flight
+            ++full;
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            continue;
+        }
+        sent += static_cast<int>(went);
+        callTsc.push_back(readTsc() - callStart);
+    }
+    drain();
+    const double seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+    const double cpuNs = threadCpuNs() - cpu0;
+
+    std::sort(callTsc.begin(), callTsc.end());
+    const uint64_t syscalls = submitCalls ? submitCalls() : socketCalls;
+    std::cout << std::left << std::setw(14) << label
+              << std::setw(7) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(10) << MESSAGES / seconds / 1e6
+              << std::setprecision(0)
+              << std::setw(9) << cpuNs / MESSAGES
+              << std::setw(10) << TscClock::toNs(callTsc[callTsc.size() / 2])
+              << std::setw(10) << TscClock::toNs(callTsc[static_cast<std::size_t>(callTsc.size() * 0.99)])
+              << std::setprecision(3)
+              << std::setw(11) << static_cast<double>(syscalls) / MESSAGES
+              << std::setw(9) << full << "\n";
+}
+
+void runSocket(std::size_t batch)
+{
+    UDPMulticastSender sender(LOOPBACK.destIp, LOOPBACK.port, LOOPBACK.interfaceIp);
+    run(batch == 1 ? "sendto" : "sendmmsg", sender, batch, [] {}, {});
+}
+
+void runUring(std::size_t batch, bool sqpoll)
+{
+    UringOptions options;
+    options.sqpoll = sqpoll;
+    try
+    {
+        UringMulticastSender sender(LOOPBACK.destIp, LOOPBACK.port, LOOPBACK.interfaceIp, options);
+        run(sqpoll ? "uring-sqpoll" : "uring", sender, batch, [&] { sender.flush(); },
+            [&] { return sender.submitCalls(); });
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << std::left << std::setw(14) << (sqpoll ? "uring-sqpoll" : "uring") << std::setw(7) << batch
+                  << "unavailable: " << e.what() << "\n";
+    }
+}
+
+int main()
+{
+    // The senders log their own errors only, keep the table readable
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    std::cout << "--- SEND BACKEND BENCHMARK (sendto / sendmmsg / io_uring) ---\n";
+    std::cout << MESSAGES << " x " << MESSAGE_SIZE << " B -> " << LOOPBACK.destIp << ":" << LOOPBACK.port
+              << " | latency per send call, CPU = sending thread only, syscalls = submitting calls per message\n\n";
+    std::cout << std::left << std::setw(14) << "Backend"
+              << std::setw(7) << "Batch"
+              << std::right
+              << std::setw(10) << "msgs M/s"
+              << std::setw(9) << "CPU ns"
+              << std::setw(10) << "p50 ns"
+              << std::setw(10) << "p99 ns"
+              << std::setw(11) << "syscalls"
+              << std::setw(9) << "full" << "\n";
+    std::cout << std::string(80, '-') << "\n";
+
+    for (std::size_t batch : BATCHES)
+        runSocket(batch);
+    for (bool sqpoll : {false, true})
+    {
+        for (std::size_t batch : BATCHES)
+            runUring(batch, sqpoll);
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <market/market_data_engine.h>
+#include <core/nonblocking_ring_buffer.h>
+
+// --- CONSTANTS ---
+// Datagrams per socket run, and the size of each (a typical FIX snapshot)
+const int MESSAGES = 1'000'000;
+const std::size_t MESSAGE_SIZE = 120;
+// Wall time of each engine run
+const auto RUN_TIME = std::chrono::milliseconds(1000);
+const std::size_t BATCHES[] = {1, 2, 4, 8, 16, 32, 64};
+// Loopback unicast so no multicast route is needed
+const TransportConfig LOOPBACK{"127.0.0.1", 9999, "127.0.0.1"};
+
+using Engine = MarketDataEngine<RandomWalkSource, LockFreeRingBuffer<MarketTick, 4096>,
+                                YieldWait, FixSnapshotEncoder, UdpTransport>;
+
+/**
+ * Socket only: MESSAGES datagrams through one UDPMulticastSender, batch 1 =
+ * send() (one sendto per datagram), larger batches = sendBatch() (one
+ * sendmmsg per batch). Latency is per call, i.e. what every datagram of
+ * the batch waits for its send to return.
+ */
+void runSocket(std::size_t batch)
+{
+    UDPMulticastSender sender(LOOPBACK.destIp, LOOPBACK.port, LOOPBACK.interfaceIp);
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'A');
+    std::vector<std::span<const uint8_t>> messages(batch, std::span<const uint8_t>(payload));
+    std::vector<uint64_t> callTsc;
+    callTsc.reserve(MESSAGES / batch + 1);
+
+    int retries = 0;
+    const uint64_t t0 = readTsc();
+    for (int sent = 0; sent < MESSAGES;)
+    {
+        const std::size_t count = std::min<std::size_t>(batch, MESSAGES - sent);
+        const uint64_t callStart = readTsc();
+        const std::size_t went = batch == 1 ? (sender.send(messages[0]) == SendStatus::Sent)
+                                            : sender.sendBatch(std::span(messages.data(), count)).sent;
+        if (went == 0)
+        {
+            // Socket buffer full: let the kernel drain it
+            ++retries;
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            continue;
+        }
+        sent += static_cast<int>(went);
+        callTsc.push_back(readTsc() - callStart);
+    }
+    const double seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+
+    std::sort(callTsc.begin(), callTsc.end());
+    std::cout << std::left << std::setw(8) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << MESSAGES / seconds / 1e6
+              << std::setprecision(0)
+              << std::setw(10) << seconds * 1e9 / MESSAGES
+              << std::setw(12) << TscClock::toNs(callTsc[callTsc.size() / 2])
+              << std::setw(12) << TscClock::toNs(callTsc[static_cast<std::size_t>(callTsc.size() * 0.99)])
+              << std::setw(10) << retries << "\n";
+}
+
+/**
+ * Whole pipeline, unpaced, UDP: sent rate and end-to-end (generated -> send
+ * return) latency with the sending thread draining up to `batch` ticks per
+ * transport call.
+ */
+void runEngine(PipelineMode mode, std::size_t batch)
+{
+    Engine engine(LOOPBACK);
+    engine.setMonitorEnabled(false);
+    engine.setPipelineMode(mode);
+    engine.setSendBatch(batch);
+
+    MetricsCollector collector({&engine.metrics()});
+    engine.start();
+    collector.collect();
+    const uint64_t t0 = readTsc();
+    std::this_thread::sleep_for(RUN_TIME);
+    collector.collect();
+    const double elapsedNs = TscClock::toNs(readTsc() - t0);
+    engine.join();
+
+    LatencySummary total = collector.histogram("latency.total");
+    std::cout << std::left << std::setw(8) << (mode == PipelineMode::ThreeStage ? "3-stage" : "2-stage")
+              << std::setw(8) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << collector.delta("ticks_sent") / elapsedNs * 1e3
+              << std::setprecision(0)
+              << std::setw(12) << TscClock::toNs(total.p50)
+              << std::setw(12) << TscClock::toNs(total.p99)
+              << std::setw(12) << collector.delta("send_retries") << "\n";
+}
+
+int main()
+{
+    // Engines log on construction, keep the tables readable
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    std::cout << "--- SEND BATCH BENCHMARK (sendto vs sendmmsg) ---\n";
+    std::cout << "UDP -> " << LOOPBACK.destIp << ":" << LOOPBACK.port << "\n\n";
+
+    std::cout << "Socket: " << MESSAGES << " x " << MESSAGE_SIZE << " B, latency per send call\n";
+    std::cout << std::left << std::setw(8) << "Batch"
+              << std::right
+              << std::setw(12) << "msgs M/s"
+              << std::setw(10) << "ns/msg"
+              << std::setw(12) << "p50 ns"
+              << std::setw(12) << "p99 ns"
+              << std::setw(10) << "ENOBUFS" << "\n";
+    std::cout << std::string(64, '-') << "\n";
+    for (std::size_t batch : BATCHES)
+        runSocket(batch);
+
+    std::cout << "\nEngine: " << RUN_TIME.count() << " ms unpaced per run, latency = generated -> send return\n";
+    std::cout << std::left << std::setw(8) << "Layout"
+              << std::setw(8) << "Batch"
+              << std::right
+              << std::setw(12) << "sent M/s"
+              << std::setw(12) << "p50 ns"
+              << std::setw(12) << "p99 ns"
+              << std::setw(12) << "retries" << "\n";
+    std::cout << std::string(64, '-') << "\n";
+    for (PipelineMode mode : {PipelineMode::TwoStage, PipelineMode::ThreeStage})
+    {
+        for (std::size_t batch : BATCHES)
+            runEngine(mode, batch);
+    }
+    return 0;
+}
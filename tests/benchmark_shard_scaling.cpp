@@ -0,0 +1,104 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <format>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <market/sharded_engine.h>
+#include <core/nonblocking_ring_buffer.h>
+
+// --- CONSTANTS ---
+const auto RUN_TIME = std::chrono::milliseconds(1000);
+const std::size_t INSTRUMENTS = 512;
+// Loopback unicast, shard i -> 127.0.0.(1 + i):(9999 + i), no multicast route needed
+const TransportConfig LOOPBACK{"127.0.0.1", 9999, "127.0.0.1"};
+
+template <typename Transport>
+using ShardEngine = MarketDataEngine<CorrelatedGBMSource, LockFreeRingBuffer<MarketTick, 8192>,
+                                     YieldWait, FixSnapshotEncoder, Transport>;
+
+// Unpaced run of `shards` pipelines, returns sent ticks / second over all shards
+template <typename Transport>
+double run(const std::vector<std::string> &symbols, std::size_t shards, const std::vector<int> &hotCpus)
+{
+    ShardedEngine<ShardEngine<Transport>> engine(symbols, ShardPartition::hash(shards), LOOPBACK, 0.3);
+    engine.setMonitorEnabled(false);
+    engine.setThreadPlacement(ThreadPlacement{}, hotCpus);
+
+    auto t0 = std::chrono::steady_clock::now();
+    engine.start();
+    std::this_thread::sleep_for(RUN_TIME);
+    uint64_t sent = engine.getSentCount();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    engine.join();
+    return sent / elapsed;
+}
+
+/**
+ * Throughput vs shard count: S = 1, 2, 4, ... independent producer / ring /
+ * encoder / socket pipelines over the same 512-instrument universe.
+ *
+ * Optional arg: --shard-cpus <cpulist>, shard i pinned to cpus[2i] (producer)
+ * and cpus[2i + 1] (consumer). Scaling stops where shards outnumber cores.
+ */
+int main(int argc, char **argv)
+{
+    // Engines log on construction and placement, keep the table readable
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    std::vector<int> hotCpus;
+    if (argc > 2 && std::string_view(argv[1]) == "--shard-cpus")
+        hotCpus = parseCpuList(argv[2]);
+
+    std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> shardCounts;
+    for (std::size_t s = 1; s <= std::max<std::size_t>(cores / 2, 4); s *= 2)
+    {
+        shardCounts.push_back(s);
+    }
+
+    std::vector<std::string> symbols;
+    for (std::size_t i = 0; i < INSTRUMENTS; ++i)
+    {
+        symbols.push_back(std::format("SYM{:04}", i));
+    }
+
+    std::cout << "--- SHARD SCALING BENCHMARK ---\n";
+    std::cout << INSTRUMENTS << " instruments, unpaced, " << RUN_TIME.count() << " ms per point, "
+              << cores << " hardware threads, hot CPUs: " << formatCpuList(hotCpus) << "\n\n";
+    std::cout << std::left << std::setw(8) << "Shards"
+              << std::right
+              << std::setw(14) << "Null M/s"
+              << std::setw(10) << "speedup"
+              << std::setw(14) << "UDP M/s"
+              << std::setw(10) << "speedup" << "\n";
+    std::cout << std::string(56, '-') << "\n";
+
+    double nullBase = 0.0;
+    double udpBase = 0.0;
+    for (std::size_t shards : shardCounts)
+    {
+        double nullRate = run<NullTransport>(symbols, shards, hotCpus);
+        double udpRate = run<UdpTransport>(symbols, shards, hotCpus);
+        if (nullBase == 0.0)
+        {
+            nullBase = nullRate;
+            udpBase = udpRate;
+        }
+
+        std::cout << std::left << std::setw(8) << shards
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << nullRate / 1e6
+                  << std::setprecision(2)
+                  << std::setw(9) << (nullBase > 0.0 ? nullRate / nullBase : 0.0) << "x"
+                  << std::setprecision(3)
+                  << std::setw(14) << udpRate / 1e6
+                  << std::setprecision(2)
+                  << std::setw(9) << (udpBase > 0.0 ? udpRate / udpBase : 0.0) << "x" << "\n";
+    }
+    return 0;
+}
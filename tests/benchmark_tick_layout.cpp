@@ -0,0 +1,142 @@
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <core/nonblocking_ring_buffer.h>
+#include <core/tsc_clock.h>
+#include <market/market_tick.h>
+#include <market/symbol_registry.h>
+
+// --- CONSTANTS ---
+const size_t BUFFER_CAPACITY = 4096; // Same ring size as the MarketDataSystems
+const int ITERATIONS = 10'000'000;
+// Cycled through by the producer, long enough to defeat SSO in the legacy tick
+const std::vector<std::string> SYMBOLS = {"ESZ5", "NQZ5", "CLF6", "GCG6", "EURUSD.SPOT.LDN.XXXX"};
+
+// The pre-interning tick: owns its symbol, not trivially copyable
+struct LegacyMarketTick
+{
+    std::string symbol;
+    double bid;
+    double ask;
+    int bid_size;
+    int ask_size;
+};
+
+// Keeps the optimiser from discarding the popped ticks
+volatile uint64_t sink = 0;
+
+template <typename Tick, typename FillFn, typename ReadFn>
+double run(int count, FillFn &&fill, ReadFn &&read)
+{
+    auto q = std::make_unique<LockFreeRingBuffer<Tick, BUFFER_CAPACITY>>();
+    std::atomic<bool> start{false};
+
+    std::thread consumer([&]()
+                         {
+        while (!start.load(std::memory_order_acquire));
+        Tick t{};
+        uint64_t acc = 0;
+        for (int i = 0; i < count; ++i) {
+            while (!q->pop(t)) {
+                cpuRelax();
+            }
+            acc += read(t);
+        }
+        sink = acc; });
+
+    std::thread producer([&]()
+                         {
+        while (!start.load(std::memory_order_acquire));
+        Tick t{};
+        for (int i = 0; i < count; ++i) {
+            fill(t, i);
+            while (!q->push(t)) {
+                cpuRelax();
+            }
+        } });
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    start.store(true, std::memory_order_release);
+
+    producer.join();
+    consumer.join();
+
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return count / std::chrono::duration<double>(t2 - t1).count();
+}
+
+double run_legacy(int count)
+{
+    return run<LegacyMarketTick>(
+        count,
+        [](LegacyMarketTick &t, int i)
+        {
+            t.symbol = SYMBOLS[i % SYMBOLS.size()];
+            t.bid = 100.0 + i * 0.01;
+            t.ask = t.bid + 0.05;
+            t.bid_size = i & 127;
+            t.ask_size = t.bid_size;
+        },
+        [](const LegacyMarketTick &t)
+        { return t.symbol.size() + static_cast<uint64_t>(t.bid_size); });
+}
+
+double run_pod(int count, const SymbolRegistry &registry, const std::vector<uint32_t> &ids)
+{
+    return run<MarketTick>(
+        count,
+        [&](MarketTick &t, int i)
+        {
+            t.symbol_id = ids[i % ids.size()];
+            t.sequence = static_cast<uint64_t>(i);
+            t.bid = 100.0 + i * 0.01;
+            t.ask = t.bid + 0.05;
+            t.bid_size = i & 127;
+            t.ask_size = t.bid_size;
+        },
+        [&](const MarketTick &t)
+        { return registry.fixField(t.symbol_id).size() + static_cast<uint64_t>(t.bid_size); });
+}
+
+void print_result(const std::string &name, std::size_t bytes, double ops_per_sec)
+{
+    std::cout << std::left << std::setw(26) << name
+              << std::right << std::setw(6) << bytes << " B"
+              << " : " << std::fixed << std::setprecision(2)
+              << std::setw(8) << (ops_per_sec / 1'000'000.0) << " M ticks/sec ("
+              << std::setprecision(1) << (1e9 / ops_per_sec) << " ns/tick)" << std::endl;
+}
+
+int main()
+{
+    SymbolRegistry registry;
+    std::vector<uint32_t> ids;
+    for (const auto &name : SYMBOLS)
+    {
+        ids.push_back(registry.intern(name));
+    }
+
+    std::cout << "--- TICK LAYOUT BENCHMARK (SPSC ring, 2 threads) ---\n";
+    std::cout << "Capacity: " << BUFFER_CAPACITY << " | Iterations: " << ITERATIONS
+              << " | Symbols: " << SYMBOLS.size() << "\n\n";
+
+    std::cout << "Warming up caches...\n";
+    run_legacy(ITERATIONS / 10);
+    run_pod(ITERATIONS / 10, registry, ids);
+    std::cout << "Warmup complete.\n\n";
+
+    double legacy = run_legacy(ITERATIONS);
+    print_result("std::string symbol tick", sizeof(LegacyMarketTick), legacy);
+
+    double pod = run_pod(ITERATIONS, registry, ids);
+    print_result("64-byte POD MarketTick", sizeof(MarketTick), pod);
+
+    std::cout << "\nSpeed-up: " << std::fixed << std::setprecision(2) << (pod / legacy) << "x" << std::endl;
+    return 0;
+}
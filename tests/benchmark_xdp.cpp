@@ -0,0 +1,307 @@
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <core/tsc_clock.h>
+#include <core/async_logger.h>
+#include <network/packet_ring_sender.h>
+#include <network/udp_sender.h>
+#include <network/xdp_capturer.h>
+#include <network/xdp_socket.h>
+#ifdef HAVE_PCAP
+#include <network/packet_capturer.h>
+#endif
+
+#include <netinet/in.h>
+
+// --- CONSTANTS ---
+// Transmit: datagrams per run, and the size of each (a typical FIX snapshot)
+const int PACKETS = 2'000'000;
+const std::size_t MESSAGE_SIZE = 120;
+const uint16_t PORT = 9999;
+// Receive: one datagram at a time for latency, then bursts for the received rate
+const int LATENCY_ROUNDS = 20'000;
+const int RATE_PACKETS = 500'000;
+const std::size_t RATE_BURST = 64;
+// How long a receiver may take before a datagram counts as lost
+const double TIMEOUT_NS = 10e6;
+
+double threadCpuNs()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * PACKETS datagrams through `sender`, `batch` per call (1 = send()), as in
+ * benchmark_packet_ring. CPU per packet is the sending thread's (on veth the
+ * receive path runs in the same context, so it counts). `systemCalls`
+ * reports a sender's own call count (empty = one per call).
+ */
+template <typename Sender>
+void transmit(const std::string &label, Sender &sender, std::size_t batch, const std::function<uint64_t()> &systemCalls)
+{
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'A');
+    std::vector<std::span<const uint8_t>> messages(batch, std::span<const uint8_t>(payload));
+
+    uint64_t calls = 0;
+    const uint64_t calls0 = systemCalls ? systemCalls() : 0;
+    const double cpu0 = threadCpuNs();
+    const uint64_t t0 = readTsc();
+    for (int sent = 0; sent < PACKETS;)
+    {
+        const std::size_t count = std::min<std::size_t>(batch, PACKETS - sent);
+        const std::size_t went = batch == 1 ? (sender.send(messages[0]) == SendStatus::Sent)
+                                            : sender.sendBatch(std::span(messages.data(), count)).sent;
+        ++calls;
+        if (went == 0)
+            sender.waitWritable(1);
+        sent += static_cast<int>(went);
+    }
+    const double seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+    const double cpuNs = threadCpuNs() - cpu0;
+    const uint64_t syscalls = systemCalls ? systemCalls() - calls0 : calls;
+
+    std::cout << std::left << std::setw(14) << label
+              << std::setw(7) << batch
+              << std::right << std::fixed << std::setprecision(3)
+              << std::setw(11) << PACKETS / seconds / 1e6
+              << std::setprecision(0)
+              << std::setw(10) << cpuNs / PACKETS
+              << std::setprecision(4)
+              << std::setw(11) << static_cast<double>(syscalls) / PACKETS << "\n";
+}
+
+// Sequence number and send time at the front of every receive-test datagram
+struct Stamp
+{
+    uint64_t sequence;
+    uint64_t sentTsc;
+};
+
+/**
+ * One receive path: poll(onPayload) hands over whatever has arrived
+ * without blocking (spinning on it is the lowest-latency way to read each).
+ */
+using Poller = std::function<void(const std::function<void(const uint8_t *, size_t)> &)>;
+
+/**
+ * Every datagram comes from the same XdpSender, so only the receive path
+ * differs. Latency: LATENCY_ROUNDS single datagrams, each waited for before
+ * the next is sent, send-to-delivery in ns. Rate: RATE_PACKETS in bursts of
+ * RATE_BURST (rounded up to whole bursts), each burst read back before the
+ * next, received per second.
+ */
+void receive(const std::string &label, XdpSender &sender, const Poller &poll)
+{
+    std::vector<uint8_t> payload(MESSAGE_SIZE, 'B');
+    uint64_t expected = 0;
+    uint64_t received = 0;
+    bool timing = true; // Latency phase
+    std::vector<double> latencies;
+    latencies.reserve(LATENCY_ROUNDS);
+    auto onPayload = [&](const uint8_t *data, size_t size)
+    {
+        const uint64_t now = readTsc();
+        Stamp stamp;
+        if (size != MESSAGE_SIZE)
+            return;
+        std::memcpy(&stamp, data, sizeof(stamp));
+        if (stamp.sequence < expected)
+            return;
+        expected = stamp.sequence + 1;
+        ++received;
+        if (timing)
+            latencies.push_back(TscClock::toNs(now - stamp.sentTsc));
+    };
+    auto stampAndSend = [&](uint64_t sequence)
+    {
+        const Stamp stamp{sequence, readTsc()};
+        std::memcpy(payload.data(), &stamp, sizeof(stamp));
+        while (sender.send(payload) != SendStatus::Sent)
+            sender.waitWritable(1);
+    };
+    // Until `target` have arrived or the timeout passes; a datagram arriving later is ignored (lost)
+    auto awaitCount = [&](uint64_t target, uint64_t nextSequence)
+    {
+        const uint64_t deadline = readTsc() + TscClock::fromNs(TIMEOUT_NS);
+        while (received < target && readTsc() < deadline)
+            poll(onPayload);
+        expected = nextSequence;
+    };
+
+    uint64_t sequence = 0;
+    for (int i = 0; i < LATENCY_ROUNDS; ++i)
+    {
+        stampAndSend(sequence);
+        ++sequence;
+        awaitCount(sequence, sequence);
+    }
+    const uint64_t latencyReceived = received;
+
+    timing = false;
+    received = 0;
+    const uint64_t start = sequence;
+    const uint64_t t0 = readTsc();
+    while (sequence < start + RATE_PACKETS)
+    {
+        for (std::size_t i = 0; i < RATE_BURST; ++i)
+            stampAndSend(sequence++);
+        awaitCount(sequence - start, sequence);
+    }
+    const double seconds = TscClock::toNs(readTsc() - t0) / 1e9;
+    const uint64_t sent = sequence - start; // Whole bursts
+    const uint64_t lost = sent - std::min(received, sent);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p)
+    { return latencies.empty() ? 0.0 : latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]; };
+    std::cout << std::left << std::setw(14) << label
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(10) << percentile(0.50)
+              << std::setw(10) << percentile(0.99)
+              << std::setw(10) << LATENCY_ROUNDS - latencyReceived
+              << std::setprecision(3)
+              << std::setw(12) << received / seconds / 1e6
+              << std::setw(10) << 100.0 * lost / sent << "\n";
+}
+
+// Bound on the destination so datagrams through the stack have somewhere to go
+int bindSink(const std::string &destIp)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(PORT);
+    inet_pton(AF_INET, destIp.c_str(), &addr.sin_addr);
+    int buffer = 8 << 20;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0)
+    {
+        std::cerr << "Could not bind a sink on " << destIp << ":" << PORT << ": " << std::strerror(errno) << "\n";
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char **argv)
+{
+    // <interface ip> <destination ip>: the two ends of a veth pair (see README)
+    const std::string interfaceIp = argc > 1 ? argv[1] : "10.77.0.1";
+    const std::string destIp = argc > 2 ? argv[2] : "10.77.0.2";
+    AsyncLogger::instance().setMinLevel(LogLevel::Warn);
+
+    int sink = bindSink(destIp);
+    if (sink < 0)
+        return 1;
+    std::string receiveDevice;
+    try
+    {
+        receiveDevice = NetInterface::owning(parseIpv4(destIp)).name;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "--- AF_XDP BENCHMARK (sendto / sendmmsg / AF_PACKET TX ring / AF_XDP) ---\n";
+    std::unique_ptr<XdpSender> xdp;
+    try
+    {
+        xdp = std::make_unique<XdpSender>(destIp, PORT, interfaceIp);
+        std::cout << "AF_XDP sender: " << (xdp->zeroCopy() ? "zero-copy" : "copy mode (driver without zero-copy)")
+                  << "\n";
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "AF_XDP unavailable: " << e.what() << " (needs CAP_NET_ADMIN / CAP_NET_RAW, Linux 5.4+)\n";
+    }
+
+    std::cout << "\nTransmit: " << PACKETS << " packets of " << MESSAGE_SIZE << " B, " << interfaceIp << " -> "
+              << destIp << ":" << PORT << " | CPU = sending thread, syscalls per packet\n\n";
+    std::cout << std::left << std::setw(14) << "Path"
+              << std::setw(7) << "Batch"
+              << std::right
+              << std::setw(11) << "pkts M/s"
+              << std::setw(10) << "CPU ns"
+              << std::setw(11) << "syscalls" << "\n";
+    std::cout << std::string(53, '-') << "\n";
+    for (std::size_t batch : {1, 64})
+    {
+        UDPMulticastSender sender(destIp, PORT, interfaceIp);
+        transmit(batch == 1 ? "sendto" : "sendmmsg", sender, batch, {});
+    }
+    try
+    {
+        PacketRingSender ring(destIp, PORT, interfaceIp);
+        for (std::size_t batch : {1, 64})
+            transmit("packet ring", ring, batch, [&] { return ring.flushCalls(); });
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "packet ring unavailable: " << e.what() << "\n";
+    }
+    if (!xdp)
+        return 0;
+    for (std::size_t batch : {1, 64})
+        transmit("af_xdp", *xdp, batch, [&] { return xdp->kicks(); });
+
+    std::cout << "\nReceive on " << receiveDevice << ", all sent by AF_XDP | latency send -> delivery (ns), "
+              << LATENCY_ROUNDS << " one at a time; rate " << RATE_PACKETS << " in bursts of " << RATE_BURST << "\n\n";
+    std::cout << std::left << std::setw(14) << "Receiver"
+              << std::right
+              << std::setw(10) << "p50"
+              << std::setw(10) << "p99"
+              << std::setw(10) << "lost"
+              << std::setw(12) << "rx M/s"
+              << std::setw(10) << "lost %" << "\n";
+    std::cout << std::string(66, '-') << "\n";
+
+    // Whatever the transmit runs left queued on the sink
+    std::vector<uint8_t> buffer(2048);
+    while (recv(sink, buffer.data(), buffer.size(), MSG_DONTWAIT) >= 0)
+    {
+    }
+    receive("udp socket", *xdp,
+            [&](const auto &onPayload)
+            {
+                const ssize_t size = recv(sink, buffer.data(), buffer.size(), MSG_DONTWAIT);
+                if (size > 0)
+                    onPayload(buffer.data(), static_cast<size_t>(size));
+            });
+    close(sink);
+
+    try
+    {
+        XdpCapturer capturer(receiveDevice, PORT);
+        receive(capturer.zeroCopy() ? "af_xdp (zc)" : "af_xdp (copy)", *xdp,
+                [&](const auto &onPayload) { capturer.poll(onPayload); });
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "AF_XDP receive unavailable: " << e.what() << "\n";
+    }
+
+#ifdef HAVE_PCAP
+    try
+    {
+        PacketCapturer capturer(receiveDevice, "udp dst port " + std::to_string(PORT), true);
+        receive("pcap", *xdp, [&](const auto &onPayload) { capturer.dispatch(onPayload); });
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "pcap receive unavailable: " << e.what() << "\n";
+    }
+#else
+    std::cout << "(pcap: built without libpcap)\n";
+#endif
+    return 0;
+}
@@ -81,17 +81,10 @@ int main()
                 auto data = fixMessage.finalize();
 
                 // 3. Send UDP with Backpressure (Retry on Buffer Full)
-                bool sent = false;
-                while (!sent) {
-                    try {
-                        // This might THROW "ENOBUFS" if the kernel is full
-                        sender.send(data);
-                        sent = true; // If we get here, it succeeded
-                    } 
-                    catch (const std::exception& e) {
-                        // Now we just pause for a microsecond to let the buffer drain
-                        std::this_thread::yield(); 
-                    }
+                SendStatus status;
+                while ((status = sender.send(data)) == SendStatus::NoBuffers || status == SendStatus::WouldBlock) {
+                    // Kernel is full: pause to let the buffer drain
+                    std::this_thread::yield();
                 }
             } });
 
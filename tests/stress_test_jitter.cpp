@@ -8,6 +8,7 @@
 #include <cmath>
 
 #include <core/blocking_ring_buffer.h>
+#include <core/thread_placement.h>
 
 // --- 1. Realistic Payload (64 Bytes) ---
 // Fits exactly in one CPU Cache Line. This stresses memory bandwidth.
@@ -34,8 +35,23 @@ void burn_cpu(int nanoseconds)
         ;
 }
 
-int main()
+// Optional args: thread placement flags (thread_placement.h), e.g.
+//   --pin-producer 2 --pin-consumer 3 --fifo 50 --require-isolated
+int main(int argc, char **argv)
 {
+    ThreadPlacement placement;
+    try
+    {
+        placement = ThreadPlacement::fromArgs(argc, argv);
+        checkThreadPlacement("producer", placement.producer, placement.requireIsolated);
+        checkThreadPlacement("consumer", placement.consumer, placement.requireIsolated);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
     BlockingRingBuffer<MarketTick, BUFFER_SIZE> queue;
 
     // Vectors to capture latency per-operation (for histogram)
@@ -47,6 +63,7 @@ int main()
     // --- PRODUCER (The Exchange) ---
     std::jthread producer([&]()
                           {
+        applyThreadPlacement("jitter-producer", placement.producer);
         while (!start_gun.load(std::memory_order_acquire));
 
         MarketTick tick;
@@ -64,6 +81,7 @@ int main()
     // --- CONSUMER (The FIX Engine) ---
     std::jthread consumer([&]()
                           {
+        applyThreadPlacement("jitter-consumer", placement.consumer);
         while (!start_gun.load(std::memory_order_acquire));
 
         MarketTick tick;